@@ -30,6 +30,11 @@
 #include <sqlpp23/core/basic/star.h>
 #include <sqlpp23/core/aggregate_function/avg.h>
 #include <sqlpp23/core/aggregate_function/count.h>
+#include <sqlpp23/core/aggregate_function/dense_rank.h>
+#include <sqlpp23/core/aggregate_function/lag.h>
+#include <sqlpp23/core/aggregate_function/lead.h>
 #include <sqlpp23/core/aggregate_function/max.h>
 #include <sqlpp23/core/aggregate_function/min.h>
+#include <sqlpp23/core/aggregate_function/rank.h>
+#include <sqlpp23/core/aggregate_function/row_number.h>
 #include <sqlpp23/core/aggregate_function/sum.h>
@@ -0,0 +1,59 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp23/core/aggregate_function/enable_over.h>
+#include <sqlpp23/core/name/create_name_tag.h>
+#include <sqlpp23/core/to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp::alias {
+SQLPP_CREATE_NAME_TAG(dense_rank_);
+}
+
+namespace sqlpp {
+// DENSE_RANK() is a window function and can only be used with over().
+struct dense_rank_t : public enable_over {};
+
+template <>
+struct is_window_function<dense_rank_t> : public std::true_type {};
+
+template <>
+struct window_data_type_of<dense_rank_t> {
+  using type = integral;
+};
+
+template <typename Context>
+auto to_sql_string(Context&, const dense_rank_t&) -> std::string {
+  return "DENSE_RANK()";
+}
+
+inline auto dense_rank() -> dense_rank_t {
+  return {};
+}
+
+}  // namespace sqlpp
@@ -0,0 +1,89 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+#include <string>
+
+#include <sqlpp23/core/aggregate_function/enable_over.h>
+#include <sqlpp23/core/name/create_name_tag.h>
+#include <sqlpp23/core/reader.h>
+#include <sqlpp23/core/to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp::alias {
+SQLPP_CREATE_NAME_TAG(lead_);
+}
+
+namespace sqlpp {
+// LEAD(expr, offset) is a window function and can only be used with over().
+template <typename Expr>
+struct lead_t : public enable_over {
+  constexpr lead_t(Expr expr, size_t offset)
+      : _lhs(std::move(expr)), _rhs(offset) {}
+  constexpr lead_t(const lead_t&) = default;
+  constexpr lead_t(lead_t&&) = default;
+  constexpr lead_t& operator=(const lead_t&) = default;
+  constexpr lead_t& operator=(lead_t&&) = default;
+  ~lead_t() = default;
+
+ private:
+  friend reader_t;
+  Expr _lhs;
+  size_t _rhs;
+};
+
+template <typename Expr>
+struct is_window_function<lead_t<Expr>> : public std::true_type {};
+
+template <typename Expr>
+struct nodes_of<lead_t<Expr>> {
+  using type = sqlpp::detail::type_vector<Expr>;
+};
+
+template <typename Expr>
+struct holds_sql_values<lead_t<Expr>> : public std::true_type {};
+
+// There might be no following row.
+template <typename Expr>
+struct window_data_type_of<lead_t<Expr>> {
+  using type = sqlpp::force_optional_t<data_type_of_t<Expr>>;
+};
+
+template <typename Context, typename Expr>
+auto to_sql_string(Context& context, const lead_t<Expr>& t) -> std::string {
+  return "LEAD(" + to_sql_string(context, read.lhs(t)) + ", " +
+         std::to_string(read.rhs(t)) + ")";
+}
+
+template <typename T>
+  requires(has_data_type_v<T> and not contains_aggregate_function<T>::value)
+auto lead(T t, size_t offset = 1) -> lead_t<T> {
+  return {std::move(t), offset};
+}
+
+}  // namespace sqlpp
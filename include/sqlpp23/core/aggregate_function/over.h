@@ -27,40 +27,303 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cstddef>
+#include <string>
+#include <tuple>
+
+#include <sqlpp23/core/concepts.h>
+#include <sqlpp23/core/database/exception.h>
 #include <sqlpp23/core/operator/enable_as.h>
 #include <sqlpp23/core/operator/enable_comparison.h>
 #include <sqlpp23/core/reader.h>
 #include <sqlpp23/core/to_sql_string.h>
+#include <sqlpp23/core/tuple_to_sql_string.h>
 #include <sqlpp23/core/type_traits.h>
 
 namespace sqlpp {
-template <typename Expr>
+// Window functions (e.g. row_number) can only be used with over().
+template <typename T>
+struct is_window_function : public std::false_type {};
+
+// The data type of a function when used with over(). Window functions
+// specialize this instead of data_type_of as they have no value on their own.
+template <typename T>
+struct window_data_type_of : public data_type_of<T> {};
+
+// Frame bounds, see rows_between and range_between.
+struct unbounded_preceding_t {};
+inline constexpr auto unbounded_preceding = unbounded_preceding_t{};
+
+struct frame_preceding_t {
+  size_t offset;
+};
+
+inline auto preceding(size_t offset) -> frame_preceding_t {
+  return {offset};
+}
+
+struct current_row_t {};
+inline constexpr auto current_row = current_row_t{};
+
+struct frame_following_t {
+  size_t offset;
+};
+
+inline auto following(size_t offset) -> frame_following_t {
+  return {offset};
+}
+
+struct unbounded_following_t {};
+inline constexpr auto unbounded_following = unbounded_following_t{};
+
+// Frame bounds in the order they can appear in a frame. A frame must not
+// start after it ends. For two bounds of the same kind, this is checked at
+// runtime, see detail::check_frame_bounds().
+template <typename T>
+struct frame_bound_position {};
+
+template <>
+struct frame_bound_position<unbounded_preceding_t>
+    : public std::integral_constant<int, 0> {};
+template <>
+struct frame_bound_position<frame_preceding_t>
+    : public std::integral_constant<int, 1> {};
+template <>
+struct frame_bound_position<current_row_t>
+    : public std::integral_constant<int, 2> {};
+template <>
+struct frame_bound_position<frame_following_t>
+    : public std::integral_constant<int, 3> {};
+template <>
+struct frame_bound_position<unbounded_following_t>
+    : public std::integral_constant<int, 4> {};
+
+template <typename Start, typename End>
+concept ValidFrameBounds =
+    requires {
+      frame_bound_position<Start>::value;
+      frame_bound_position<End>::value;
+    } and
+    not std::is_same_v<Start, unbounded_following_t> and
+    not std::is_same_v<End, unbounded_preceding_t> and
+    frame_bound_position<Start>::value <= frame_bound_position<End>::value;
+
+template <typename Context>
+auto to_sql_string(Context&, const unbounded_preceding_t&) -> std::string {
+  return "UNBOUNDED PRECEDING";
+}
+
+template <typename Context>
+auto to_sql_string(Context&, const frame_preceding_t& t) -> std::string {
+  return std::to_string(t.offset) + " PRECEDING";
+}
+
+template <typename Context>
+auto to_sql_string(Context&, const current_row_t&) -> std::string {
+  return "CURRENT ROW";
+}
+
+template <typename Context>
+auto to_sql_string(Context&, const frame_following_t& t) -> std::string {
+  return std::to_string(t.offset) + " FOLLOWING";
+}
+
+template <typename Context>
+auto to_sql_string(Context&, const unbounded_following_t&) -> std::string {
+  return "UNBOUNDED FOLLOWING";
+}
+
+struct frame_rows_t {};
+struct frame_range_t {};
+
+template <typename Context>
+auto to_sql_string(Context&, const frame_rows_t&) -> std::string {
+  return "ROWS";
+}
+
+template <typename Context>
+auto to_sql_string(Context&, const frame_range_t&) -> std::string {
+  return "RANGE";
+}
+
+namespace detail {
+// ValidFrameBounds orders bounds of different kinds. The order of two bounds
+// of the same kind depends on their offsets, which are only known at runtime.
+template <typename Start, typename End>
+void check_frame_bounds(const Start& start, const End& end) {
+  if constexpr (std::is_same_v<Start, frame_preceding_t> and
+                std::is_same_v<End, frame_preceding_t>) {
+    if (start.offset < end.offset) {
+      throw exception{"window frame: start must not be after end (" +
+                      std::to_string(start.offset) + " PRECEDING AND " +
+                      std::to_string(end.offset) + " PRECEDING)"};
+    }
+  } else if constexpr (std::is_same_v<Start, frame_following_t> and
+                       std::is_same_v<End, frame_following_t>) {
+    if (start.offset > end.offset) {
+      throw exception{"window frame: start must not be after end (" +
+                      std::to_string(start.offset) + " FOLLOWING AND " +
+                      std::to_string(end.offset) + " FOLLOWING)"};
+    }
+  }
+}
+}  // namespace detail
+
+template <typename Unit, typename Start, typename End>
+struct window_frame_t {
+  // Throws sqlpp::exception if the frame starts after it ends.
+  window_frame_t(Start start, End end)
+      : _lhs(std::move(start)), _rhs(std::move(end)) {
+    detail::check_frame_bounds(_lhs, _rhs);
+  }
+  constexpr window_frame_t(const window_frame_t&) = default;
+  constexpr window_frame_t(window_frame_t&&) = default;
+  constexpr window_frame_t& operator=(const window_frame_t&) = default;
+  constexpr window_frame_t& operator=(window_frame_t&&) = default;
+  ~window_frame_t() = default;
+
+ private:
+  friend reader_t;
+  Start _lhs;
+  End _rhs;
+};
+
+template <typename Context, typename Unit, typename Start, typename End>
+auto to_sql_string(Context& context,
+                   const window_frame_t<Unit, Start, End>& t) -> std::string {
+  return " " + to_sql_string(context, Unit{}) + " BETWEEN " +
+         to_sql_string(context, read.lhs(t)) + " AND " +
+         to_sql_string(context, read.rhs(t));
+}
+
+struct no_window_frame_t {};
+
+template <typename Context>
+auto to_sql_string(Context&, const no_window_frame_t&) -> std::string {
+  return "";
+}
+
+template <typename Expr,
+          typename PartitionBy = std::tuple<>,
+          typename OrderBy = std::tuple<>,
+          typename Frame = no_window_frame_t>
 struct over_t : public enable_as, public enable_comparison {
-  constexpr over_t(Expr expr) : _expression(expr) {}
+  constexpr over_t(Expr expr) : _expression(std::move(expr)) {}
+  constexpr over_t(Expr expr,
+                   PartitionBy partition_by,
+                   OrderBy order_by,
+                   Frame frame)
+      : _expression(std::move(expr)),
+        _partition_by(std::move(partition_by)),
+        _order_by(std::move(order_by)),
+        _frame(std::move(frame)) {}
   constexpr over_t(const over_t&) = default;
   constexpr over_t(over_t&&) = default;
   constexpr over_t& operator=(const over_t&) = default;
   constexpr over_t& operator=(over_t&&) = default;
   ~over_t() = default;
 
+  template <DynamicValue... Expressions>
+    requires(sizeof...(Expressions) > 0 and
+             std::is_same_v<PartitionBy, std::tuple<>>)
+  auto partition_by(Expressions... expressions) const
+      -> over_t<Expr, std::tuple<Expressions...>, OrderBy, Frame> {
+    return {_expression, std::tuple<Expressions...>{std::move(expressions)...},
+            _order_by, _frame};
+  }
+
+  template <DynamicSortOrder... Expressions>
+    requires(sizeof...(Expressions) > 0 and
+             std::is_same_v<OrderBy, std::tuple<>>)
+  auto order_by(Expressions... expressions) const
+      -> over_t<Expr, PartitionBy, std::tuple<Expressions...>, Frame> {
+    return {_expression, _partition_by,
+            std::tuple<Expressions...>{std::move(expressions)...}, _frame};
+  }
+
+  template <typename Start, typename End>
+    requires(ValidFrameBounds<Start, End> and
+             std::is_same_v<Frame, no_window_frame_t>)
+  auto rows_between(Start start, End end) const
+      -> over_t<Expr,
+                PartitionBy,
+                OrderBy,
+                window_frame_t<frame_rows_t, Start, End>> {
+    return {_expression, _partition_by, _order_by,
+            window_frame_t<frame_rows_t, Start, End>{std::move(start),
+                                                     std::move(end)}};
+  }
+
+  template <typename Start, typename End>
+    requires(ValidFrameBounds<Start, End> and
+             std::is_same_v<Frame, no_window_frame_t>)
+  auto range_between(Start start, End end) const
+      -> over_t<Expr,
+                PartitionBy,
+                OrderBy,
+                window_frame_t<frame_range_t, Start, End>> {
+    return {_expression, _partition_by, _order_by,
+            window_frame_t<frame_range_t, Start, End>{std::move(start),
+                                                      std::move(end)}};
+  }
+
  private:
   friend reader_t;
   Expr _expression;
+  PartitionBy _partition_by;
+  OrderBy _order_by;
+  Frame _frame;
 };
 
-template <typename Expr>
-struct nodes_of<over_t<Expr>> : public nodes_of<Expr> {};
+template <typename Expr,
+          typename... Partitions,
+          typename... Orders,
+          typename Frame>
+struct nodes_of<
+    over_t<Expr, std::tuple<Partitions...>, std::tuple<Orders...>, Frame>> {
+  using type = detail::type_vector_cat_t<
+      nodes_of_t<Expr>,
+      detail::type_vector<Partitions..., Orders...>>;
+};
 
-template <typename Expr>
-struct data_type_of<over_t<Expr>> : public data_type_of<Expr> {};
+// The offsets of preceding() and following() are not nodes.
+template <typename Expr,
+          typename PartitionBy,
+          typename OrderBy,
+          typename Unit,
+          typename Start,
+          typename End>
+struct holds_sql_values<
+    over_t<Expr, PartitionBy, OrderBy, window_frame_t<Unit, Start, End>>>
+    : public std::bool_constant<not std::is_empty_v<Start> or
+                                not std::is_empty_v<End>> {};
+
+template <typename Expr, typename PartitionBy, typename OrderBy, typename Frame>
+struct data_type_of<over_t<Expr, PartitionBy, OrderBy, Frame>>
+    : public window_data_type_of<Expr> {};
 
-template <typename Context, typename Expr>
-auto to_sql_string(Context& context, const over_t<Expr>& t) -> std::string {
-  return operand_to_sql_string(context, read.expression(t)) + " OVER()";
+template <typename Context,
+          typename Expr,
+          typename PartitionBy,
+          typename OrderBy,
+          typename Frame>
+auto to_sql_string(Context& context,
+                   const over_t<Expr, PartitionBy, OrderBy, Frame>& t)
+    -> std::string {
+  // Each part of the window specification starts with a space (or is empty).
+  const auto window =
+      dynamic_tuple_clause_to_sql_string(context, "PARTITION BY",
+                                         read.partition_by(t)) +
+      dynamic_tuple_clause_to_sql_string(context, "ORDER BY",
+                                         read.order_by(t)) +
+      to_sql_string(context, read.frame(t));
+  return operand_to_sql_string(context, read.expression(t)) + " OVER(" +
+         (window.empty() ? window : window.substr(1)) + ")";
 }
 
 template <typename Expr>
-  requires(is_aggregate_function<Expr>::value)
+  requires(is_aggregate_function<Expr>::value or
+           is_window_function<Expr>::value)
 auto over(Expr t) -> over_t<Expr> {
   return {std::move(t)};
 }
@@ -0,0 +1,553 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/arrow/c_data_interface.h>
+#include <sqlpp23/core/query/result_row.h>
+#include <sqlpp23/core/type_traits.h>
+#include <sqlpp23/core/wrong.h>
+
+// Export of select results as Arrow record batches via the Arrow C data
+// interface. Each batch is a struct array with one child per selected column.
+// The schema is derived from the result row's field specs at compile time.
+//
+// Column buffers are filled straight from the fields of the current result
+// row, i.e. from the connector's buffers, without materializing rows first.
+namespace sqlpp::arrow {
+inline constexpr int64_t nullable_flag = ARROW_FLAG_NULLABLE;
+
+namespace detail {
+// Arrow requires buffers to be non-null unless they are validity bitmaps.
+inline constexpr int64_t empty_buffer[1] = {0};
+
+inline const void* buffer_or_empty(const void* buffer) {
+  return buffer ? buffer : empty_buffer;
+}
+
+// Owns everything an exported ArrowArray points to, until the consumer calls
+// release.
+struct array_private {
+  std::vector<uint8_t> validity;
+  std::vector<uint8_t> values;
+  std::vector<int64_t> offsets;
+  std::vector<char> data;
+  std::vector<const void*> buffers;
+  std::vector<std::unique_ptr<ArrowArray>> children;
+  std::vector<ArrowArray*> child_pointers;
+};
+
+inline void release_array(ArrowArray* array) {
+  auto* priv = static_cast<array_private*>(array->private_data);
+  for (auto* child : priv->child_pointers) {
+    if (child->release) {
+      child->release(child);
+    }
+  }
+  delete priv;
+  array->release = nullptr;
+}
+
+inline void init_array(ArrowArray* out,
+                       array_private* priv,
+                       int64_t length,
+                       int64_t null_count) {
+  *out = ArrowArray{.length = length,
+                    .null_count = null_count,
+                    .offset = 0,
+                    .n_buffers = static_cast<int64_t>(priv->buffers.size()),
+                    .n_children = static_cast<int64_t>(priv->children.size()),
+                    .buffers = priv->buffers.data(),
+                    .children = priv->child_pointers.empty()
+                                    ? nullptr
+                                    : priv->child_pointers.data(),
+                    .dictionary = nullptr,
+                    .release = &release_array,
+                    .private_data = priv};
+}
+
+// Owns everything an exported ArrowSchema points to.
+struct schema_private {
+  std::string name;
+  std::vector<std::unique_ptr<ArrowSchema>> children;
+  std::vector<ArrowSchema*> child_pointers;
+};
+
+inline void release_schema(ArrowSchema* schema) {
+  auto* priv = static_cast<schema_private*>(schema->private_data);
+  for (auto* child : priv->child_pointers) {
+    if (child->release) {
+      child->release(child);
+    }
+  }
+  delete priv;
+  schema->release = nullptr;
+}
+
+// Bit-packed, least significant bit first, as required by Arrow for both
+// validity bitmaps and boolean values.
+class bitmap {
+ public:
+  void reserve(size_t bits) { _bytes.reserve((bits + 7) / 8); }
+
+  void push_back(bool bit) {
+    if (_size % 8 == 0) {
+      _bytes.push_back(0);
+    }
+    if (bit) {
+      _bytes.back() =
+          static_cast<uint8_t>(_bytes.back() | (1u << (_size % 8)));
+    }
+    ++_size;
+  }
+
+  std::vector<uint8_t> release() {
+    _size = 0;
+    return std::exchange(_bytes, {});
+  }
+
+ private:
+  std::vector<uint8_t> _bytes;
+  size_t _size = 0;
+};
+
+// Buffers of fixed-width columns: integral, unsigned_integral,
+// floating_point, date, time and timestamp.
+template <typename Storage>
+class fixed_width_buffers {
+ public:
+  void reserve(size_t rows) { _values.reserve(rows * sizeof(Storage)); }
+
+  void append_null() { append(Storage{}); }
+
+  void append(Storage value) {
+    const auto size = _values.size();
+    _values.resize(size + sizeof(Storage));
+    std::memcpy(_values.data() + size, &value, sizeof(Storage));
+  }
+
+  void move_to(array_private& priv) {
+    priv.values = std::exchange(_values, {});
+    priv.buffers.push_back(detail::buffer_or_empty(priv.values.data()));
+  }
+
+ private:
+  std::vector<uint8_t> _values;
+};
+
+class boolean_buffers {
+ public:
+  void reserve(size_t rows) { _values.reserve(rows); }
+
+  void append_null() { _values.push_back(false); }
+
+  void append(bool value) { _values.push_back(value); }
+
+  void move_to(array_private& priv) {
+    priv.values = _values.release();
+    priv.buffers.push_back(detail::buffer_or_empty(priv.values.data()));
+  }
+
+ private:
+  bitmap _values;
+};
+
+// Buffers of large_utf8 and large_binary columns (64 bit offsets).
+class variable_width_buffers {
+ public:
+  variable_width_buffers() { _offsets.push_back(0); }
+
+  void reserve(size_t rows) { _offsets.reserve(rows + 1); }
+
+  void append_null() { _offsets.push_back(_offsets.back()); }
+
+  void append(const void* data, size_t size) {
+    const auto* begin = static_cast<const char*>(data);
+    _data.insert(_data.end(), begin, begin + size);
+    _offsets.push_back(static_cast<int64_t>(_data.size()));
+  }
+
+  void move_to(array_private& priv) {
+    priv.offsets = std::exchange(_offsets, {0});
+    priv.data = std::exchange(_data, {});
+    priv.buffers.push_back(priv.offsets.data());
+    priv.buffers.push_back(detail::buffer_or_empty(priv.data.data()));
+  }
+
+ private:
+  std::vector<int64_t> _offsets;
+  std::vector<char> _data;
+};
+
+// Maps sqlpp23 data types to Arrow format strings and column buffers.
+template <typename DataType>
+struct column_traits {
+  static_assert(wrong_t<DataType>::value,
+                "Missing Arrow mapping for data type");
+};
+
+template <>
+struct column_traits<boolean> {
+  static constexpr const char* format = "b";
+  using buffers = boolean_buffers;
+  static void append(buffers& b, bool value) { b.append(value); }
+};
+
+template <>
+struct column_traits<integral> {
+  static constexpr const char* format = "l";
+  using buffers = fixed_width_buffers<int64_t>;
+  static void append(buffers& b, int64_t value) { b.append(value); }
+};
+
+template <>
+struct column_traits<unsigned_integral> {
+  static constexpr const char* format = "L";
+  using buffers = fixed_width_buffers<uint64_t>;
+  static void append(buffers& b, uint64_t value) { b.append(value); }
+};
+
+template <>
+struct column_traits<floating_point> {
+  static constexpr const char* format = "g";
+  using buffers = fixed_width_buffers<double>;
+  static void append(buffers& b, double value) { b.append(value); }
+};
+
+template <>
+struct column_traits<text> {
+  static constexpr const char* format = "U";
+  using buffers = variable_width_buffers;
+  static void append(buffers& b, std::string_view value) {
+    b.append(value.data(), value.size());
+  }
+};
+
+template <>
+struct column_traits<blob> {
+  static constexpr const char* format = "Z";
+  using buffers = variable_width_buffers;
+  static void append(buffers& b, std::span<const uint8_t> value) {
+    b.append(value.data(), value.size());
+  }
+};
+
+// date32: days since the epoch
+template <>
+struct column_traits<date> {
+  static constexpr const char* format = "tdD";
+  using buffers = fixed_width_buffers<int32_t>;
+  static void append(buffers& b, std::chrono::sys_days value) {
+    b.append(static_cast<int32_t>(value.time_since_epoch().count()));
+  }
+};
+
+// time64: microseconds since midnight
+template <>
+struct column_traits<time> {
+  static constexpr const char* format = "ttu";
+  using buffers = fixed_width_buffers<int64_t>;
+  static void append(buffers& b, std::chrono::microseconds value) {
+    b.append(static_cast<int64_t>(value.count()));
+  }
+};
+
+// timestamp: microseconds since the epoch, UTC
+template <>
+struct column_traits<timestamp> {
+  static constexpr const char* format = "tsu:UTC";
+  using buffers = fixed_width_buffers<int64_t>;
+  static void append(
+      buffers& b,
+      std::chrono::time_point<std::chrono::system_clock,
+                              std::chrono::microseconds> value) {
+    b.append(static_cast<int64_t>(value.time_since_epoch().count()));
+  }
+};
+
+template <typename DataType>
+class column_builder {
+  using _traits = column_traits<remove_optional_t<DataType>>;
+
+ public:
+  static constexpr bool is_nullable = is_optional<DataType>::value;
+
+  void reserve(size_t rows) {
+    _buffers.reserve(rows);
+    if constexpr (is_nullable) {
+      _validity.reserve(rows);
+    }
+  }
+
+  template <typename Value>
+  void append(const std::optional<Value>& value) {
+    if (value.has_value()) {
+      append(*value);
+    } else {
+      _validity.push_back(false);
+      ++_null_count;
+      _buffers.append_null();
+    }
+  }
+
+  template <typename Value>
+  void append(const Value& value) {
+    if constexpr (is_nullable) {
+      _validity.push_back(true);
+    }
+    _traits::append(_buffers, value);
+  }
+
+  void export_to(ArrowArray* out, int64_t length) {
+    auto priv = std::make_unique<array_private>();
+    if (_null_count > 0) {
+      priv->validity = _validity.release();
+      priv->buffers.push_back(priv->validity.data());
+    } else {
+      _validity.release();
+      priv->buffers.push_back(nullptr);
+    }
+    _buffers.move_to(*priv);
+    init_array(out, priv.release(), length, std::exchange(_null_count, 0));
+  }
+
+  static void export_schema(ArrowSchema* out, std::string_view name) {
+    auto priv = std::make_unique<schema_private>();
+    priv->name = name;
+    *out = ArrowSchema{.format = _traits::format,
+                       .name = priv->name.c_str(),
+                       .metadata = nullptr,
+                       .flags = is_nullable ? nullable_flag : 0,
+                       .n_children = 0,
+                       .children = nullptr,
+                       .dictionary = nullptr,
+                       .release = &release_schema,
+                       .private_data = priv.release()};
+  }
+
+ private:
+  typename _traits::buffers _buffers;
+  bitmap _validity;
+  int64_t _null_count = 0;
+};
+
+template <typename Row>
+struct record_batch_columns {
+  static_assert(wrong_t<Row>::value,
+                "Arrow export requires the result row of a select");
+};
+
+template <typename... FieldSpecs>
+struct record_batch_columns<result_row_t<FieldSpecs...>> {
+  using type = std::tuple<column_builder<data_type_of_t<FieldSpecs>>...>;
+};
+}  // namespace detail
+
+// Collects result rows column by column and exports them as a record batch,
+// i.e. a struct array with one child array per result field.
+template <typename Row>
+class record_batch_builder {
+  using _columns_t = typename detail::record_batch_columns<Row>::type;
+  static constexpr auto _column_count = std::tuple_size_v<_columns_t>;
+  using _index_sequence = std::make_index_sequence<_column_count>;
+
+ public:
+  void reserve(size_t rows) {
+    std::apply([rows](auto&... columns) { (columns.reserve(rows), ...); },
+               _columns);
+  }
+
+  void append(const Row& row) {
+    _append(as_tuple(row), _index_sequence{});
+    ++_length;
+  }
+
+  int64_t size() const { return _length; }
+
+  // Moves the collected rows into `out` and resets the builder.
+  void export_to(ArrowArray* out) {
+    auto priv = std::make_unique<detail::array_private>();
+    priv->buffers.push_back(nullptr);
+    _export_columns(*priv, _index_sequence{});
+    detail::init_array(out, priv.release(), std::exchange(_length, 0), 0);
+  }
+
+  static void export_schema(ArrowSchema* out) {
+    auto priv = std::make_unique<detail::schema_private>();
+    _export_column_schemas(*priv, _index_sequence{});
+    *out = ArrowSchema{.format = "+s",
+                       .name = priv->name.c_str(),
+                       .metadata = nullptr,
+                       .flags = 0,
+                       .n_children = static_cast<int64_t>(_column_count),
+                       .children = priv->child_pointers.data(),
+                       .dictionary = nullptr,
+                       .release = &detail::release_schema,
+                       .private_data = priv.release()};
+  }
+
+ private:
+  template <typename Values, size_t... Is>
+  void _append(const Values& values, std::index_sequence<Is...>) {
+    (std::get<Is>(_columns).append(std::get<Is>(values)), ...);
+  }
+
+  template <size_t... Is>
+  void _export_columns(detail::array_private& priv,
+                       std::index_sequence<Is...>) {
+    for (size_t i = 0; i < _column_count; ++i) {
+      priv.children.push_back(std::make_unique<ArrowArray>());
+      priv.child_pointers.push_back(priv.children.back().get());
+    }
+    (std::get<Is>(_columns).export_to(priv.child_pointers[Is], _length), ...);
+  }
+
+  template <size_t... Is>
+  static void _export_column_schemas(detail::schema_private& priv,
+                                     std::index_sequence<Is...>) {
+    const auto names = get_sql_name_tuple(Row{});
+    for (size_t i = 0; i < _column_count; ++i) {
+      priv.children.push_back(std::make_unique<ArrowSchema>());
+      priv.child_pointers.push_back(priv.children.back().get());
+    }
+    (std::tuple_element_t<Is, _columns_t>::export_schema(
+         priv.child_pointers[Is], std::get<Is>(names)),
+     ...);
+  }
+
+  _columns_t _columns;
+  int64_t _length = 0;
+};
+
+template <typename Result>
+using result_row_of_t =
+    std::remove_cvref_t<decltype(std::declval<Result&>().front())>;
+
+// Exports the schema of the rows of `Result`.
+template <typename Result>
+void export_schema(const Result&, ArrowSchema* out) {
+  record_batch_builder<result_row_of_t<Result>>::export_schema(out);
+}
+
+// Consumes up to `max_rows` rows from `result` and exports them as one record
+// batch. Returns the number of rows in the batch (0 once the result is
+// exhausted, in which case `out` still receives a valid, empty batch).
+template <typename Result>
+int64_t export_record_batch(Result& result, ArrowArray* out, size_t max_rows) {
+  record_batch_builder<result_row_of_t<Result>> builder;
+  builder.reserve(max_rows);
+  for (size_t i = 0; i < max_rows and not result.empty(); ++i) {
+    builder.append(result.front());
+    result.pop_front();
+  }
+  const auto rows = builder.size();
+  builder.export_to(out);
+  return rows;
+}
+
+namespace detail {
+template <typename Result>
+struct stream_private {
+  Result result;
+  size_t max_rows_per_batch;
+  std::string last_error;
+};
+
+template <typename Result>
+int stream_get_schema(ArrowArrayStream*, ArrowSchema* out) {
+  try {
+    record_batch_builder<result_row_of_t<Result>>::export_schema(out);
+    return 0;
+  } catch (...) {
+    return ENOMEM;
+  }
+}
+
+template <typename Result>
+int stream_get_next(ArrowArrayStream* stream, ArrowArray* out) {
+  auto& priv = *static_cast<stream_private<Result>*>(stream->private_data);
+  try {
+    if (priv.result.empty()) {
+      // Marks the end of the stream.
+      out->release = nullptr;
+      return 0;
+    }
+    export_record_batch(priv.result, out, priv.max_rows_per_batch);
+    return 0;
+  } catch (const std::exception& e) {
+    priv.last_error = e.what();
+    return EIO;
+  }
+}
+
+template <typename Result>
+const char* stream_get_last_error(ArrowArrayStream* stream) {
+  auto& priv = *static_cast<stream_private<Result>*>(stream->private_data);
+  return priv.last_error.empty() ? nullptr : priv.last_error.c_str();
+}
+
+template <typename Result>
+void stream_release(ArrowArrayStream* stream) {
+  delete static_cast<stream_private<Result>*>(stream->private_data);
+  stream->release = nullptr;
+}
+}  // namespace detail
+
+// Hands `result` over to an Arrow array stream that yields record batches of
+// at most `max_rows_per_batch` rows. Rows are fetched from the database
+// lazily, one batch per call of `get_next`.
+//
+// The stream holds on to the result (and thereby to the connector's
+// statement). The connection must therefore outlive the stream.
+template <typename Result>
+void export_stream(Result&& result,
+                   ArrowArrayStream* out,
+                   size_t max_rows_per_batch = 64 * 1024) {
+  using _result_t = std::remove_cvref_t<Result>;
+  *out = ArrowArrayStream{
+      .get_schema = &detail::stream_get_schema<_result_t>,
+      .get_next = &detail::stream_get_next<_result_t>,
+      .get_last_error = &detail::stream_get_last_error<_result_t>,
+      .release = &detail::stream_release<_result_t>,
+      .private_data = new detail::stream_private<_result_t>{
+          std::forward<Result>(result), max_rows_per_batch, {}}};
+}
+}  // namespace sqlpp::arrow
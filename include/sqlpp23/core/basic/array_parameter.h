@@ -0,0 +1,97 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+#include <string>
+
+#include <sqlpp23/core/basic/parameter.h>
+#include <sqlpp23/core/query/bind_parameter.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp {
+// A parameter that binds a list of values, e.g. for `IN`.
+// Connectors with array support (PostgreSQL) use a single array placeholder.
+// Others use `Capacity` placeholders, see bind_parameter.h.
+template <typename DataType, typename NameTag, size_t Capacity>
+struct array_parameter_t {
+  static_assert(Capacity > 0, "array_parameter requires a capacity > 0");
+  static_assert(not is_boolean<DataType>::value,
+                "array_parameter does not support boolean values");
+
+  using _instance_t = typename NameTag::template _member_t<
+      array_parameter_value<parameter_value_t<remove_optional_t<DataType>>,
+                            Capacity>>;
+
+  array_parameter_t() = default;
+  array_parameter_t(const array_parameter_t&) = default;
+  array_parameter_t(array_parameter_t&&) = default;
+  array_parameter_t& operator=(const array_parameter_t&) = default;
+  array_parameter_t& operator=(array_parameter_t&&) = default;
+  ~array_parameter_t() = default;
+};
+
+template <typename DataType, typename NameTag, size_t Capacity>
+struct parameters_of<array_parameter_t<DataType, NameTag, Capacity>> {
+  using type =
+      detail::type_vector<array_parameter_t<DataType, NameTag, Capacity>>;
+};
+
+template <typename Context,
+          typename DataType,
+          typename NameTag,
+          size_t Capacity>
+auto to_sql_string(Context&,
+                   const array_parameter_t<DataType, NameTag, Capacity>&)
+    -> std::string {
+  auto result = std::string{"?"};
+  result.reserve(Capacity * 3);
+  for (size_t i = 1; i < Capacity; ++i) {
+    result += ", ?";
+  }
+  return result;
+}
+
+template <size_t Capacity, typename NamedExpr>
+  requires(has_data_type<NamedExpr>::value and
+           has_name_tag<NamedExpr>::value)
+auto array_parameter(const NamedExpr& /*unused*/)
+    -> array_parameter_t<data_type_of_t<NamedExpr>,
+                         name_tag_of_t<NamedExpr>,
+                         Capacity> {
+  return {};
+}
+
+template <size_t Capacity, typename DataType, typename NameTagProvider>
+  requires((is_data_type<DataType>::value or has_data_type<DataType>::value) and
+           has_name_tag<NameTagProvider>::value)
+auto array_parameter(const DataType& /*unused*/,
+                     const NameTagProvider& /*unused*/)
+    -> array_parameter_t<DataType, name_tag_of_t<NameTagProvider>, Capacity> {
+  return {};
+}
+}  // namespace sqlpp
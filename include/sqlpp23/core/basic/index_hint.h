@@ -0,0 +1,179 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <utility>
+
+#include <sqlpp23/core/basic/enable_join.h>
+#include <sqlpp23/core/basic/table.h>
+#include <sqlpp23/core/basic/table_as.h>
+#include <sqlpp23/core/detail/type_set.h>
+#include <sqlpp23/core/reader.h>
+#include <sqlpp23/core/to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp {
+// MySQL index hints.
+struct use_index_t {
+  static constexpr auto _name = " USE INDEX";
+};
+struct force_index_t {
+  static constexpr auto _name = " FORCE INDEX";
+};
+struct ignore_index_t {
+  static constexpr auto _name = " IGNORE INDEX";
+};
+
+// SQLite index hints.
+struct indexed_by_t {
+  static constexpr auto _name = " INDEXED BY";
+};
+struct not_indexed_t {
+  static constexpr auto _name = " NOT INDEXED";
+};
+
+// A table (or table alias) with an index hint, e.g.
+// `tab_foo USE INDEX (idx_foo)`. Indexes are given as name tags, see
+// SQLPP_CREATE_NAME_TAG.
+template <typename Table, typename Hint, typename... Indexes>
+struct index_hint_t : public enable_join {
+  index_hint_t(Table table) : _table(std::move(table)) {}
+
+  index_hint_t(const index_hint_t& rhs) = default;
+  index_hint_t(index_hint_t&& rhs) = default;
+  index_hint_t& operator=(const index_hint_t& rhs) = default;
+  index_hint_t& operator=(index_hint_t&& rhs) = default;
+  ~index_hint_t() = default;
+
+ private:
+  friend reader_t;
+  Table _table;
+};
+
+template <typename Table, typename Hint, typename... Indexes>
+struct is_table<index_hint_t<Table, Hint, Indexes...>> : public std::true_type {
+};
+
+template <typename Table, typename Hint, typename... Indexes>
+struct name_tag_of<index_hint_t<Table, Hint, Indexes...>>
+    : public name_tag_of<Table> {};
+
+template <typename Table, typename Hint, typename... Indexes>
+struct nodes_of<index_hint_t<Table, Hint, Indexes...>> {
+  using type = detail::type_vector<Table>;
+};
+
+template <typename Table, typename Hint, typename... Indexes>
+struct provided_tables_of<index_hint_t<Table, Hint, Indexes...>>
+    : public provided_tables_of<Table> {};
+
+template <typename Context, typename Table, typename Hint>
+auto to_sql_string(Context& context, const index_hint_t<Table, Hint>& t)
+    -> std::string {
+  return to_sql_string(context, read.table(t)) + Hint::_name;
+}
+
+template <typename Context, typename Table, typename Index>
+auto to_sql_string(Context& context,
+                   const index_hint_t<Table, indexed_by_t, Index>& t)
+    -> std::string {
+  return to_sql_string(context, read.table(t)) + indexed_by_t::_name + " " +
+         name_to_sql_string(context, Index{});
+}
+
+template <typename Context,
+          typename Table,
+          typename Hint,
+          typename Index,
+          typename... Indexes>
+auto to_sql_string(Context& context,
+                   const index_hint_t<Table, Hint, Index, Indexes...>& t)
+    -> std::string {
+  return to_sql_string(context, read.table(t)) + Hint::_name + " (" +
+         name_to_sql_string(context, Index{}) +
+         ((", " + name_to_sql_string(context, Indexes{})) + ... + "") + ")";
+}
+
+// Index hints can be attached to tables and table aliases.
+template <typename T>
+struct can_have_index_hint : public std::false_type {};
+
+template <typename TableSpec>
+struct can_have_index_hint<table_t<TableSpec>> : public std::true_type {};
+
+template <typename TableSpec, typename NameTag>
+struct can_have_index_hint<table_as_t<TableSpec, NameTag>>
+    : public std::true_type {};
+
+template <typename Table, typename... IndexNameTagProviders>
+  requires(can_have_index_hint<Table>::value and
+           sizeof...(IndexNameTagProviders) > 0 and
+           (has_name_tag<IndexNameTagProviders>::value and ...))
+auto use_index(Table table, const IndexNameTagProviders&... /*unused*/)
+    -> index_hint_t<Table,
+                    use_index_t,
+                    name_tag_of_t<IndexNameTagProviders>...> {
+  return {std::move(table)};
+}
+
+template <typename Table, typename... IndexNameTagProviders>
+  requires(can_have_index_hint<Table>::value and
+           sizeof...(IndexNameTagProviders) > 0 and
+           (has_name_tag<IndexNameTagProviders>::value and ...))
+auto force_index(Table table, const IndexNameTagProviders&... /*unused*/)
+    -> index_hint_t<Table,
+                    force_index_t,
+                    name_tag_of_t<IndexNameTagProviders>...> {
+  return {std::move(table)};
+}
+
+template <typename Table, typename... IndexNameTagProviders>
+  requires(can_have_index_hint<Table>::value and
+           sizeof...(IndexNameTagProviders) > 0 and
+           (has_name_tag<IndexNameTagProviders>::value and ...))
+auto ignore_index(Table table, const IndexNameTagProviders&... /*unused*/)
+    -> index_hint_t<Table,
+                    ignore_index_t,
+                    name_tag_of_t<IndexNameTagProviders>...> {
+  return {std::move(table)};
+}
+
+template <typename Table, typename IndexNameTagProvider>
+  requires(can_have_index_hint<Table>::value and
+           has_name_tag<IndexNameTagProvider>::value)
+auto indexed_by(Table table, const IndexNameTagProvider& /*unused*/)
+    -> index_hint_t<Table, indexed_by_t, name_tag_of_t<IndexNameTagProvider>> {
+  return {std::move(table)};
+}
+
+template <typename Table>
+  requires(can_have_index_hint<Table>::value)
+auto not_indexed(Table table) -> index_hint_t<Table, not_indexed_t> {
+  return {std::move(table)};
+}
+
+}  // namespace sqlpp
@@ -78,6 +78,10 @@ struct nodes_of<parameterized_verbatim_t<DataType, Expr>> {
   using type = detail::type_vector<Expr>;
 };
 
+template <typename DataType, typename Expr>
+struct holds_sql_values<parameterized_verbatim_t<DataType, Expr>>
+    : public std::true_type {};
+
 template <typename Context, typename DataType, typename Expr>
 auto to_sql_string(Context& context,
                    const parameterized_verbatim_t<DataType, Expr>& t)
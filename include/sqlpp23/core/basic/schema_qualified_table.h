@@ -63,6 +63,10 @@ struct provided_tables_of<schema_qualified_table_as_t<TableSpec, NameTag>> {
       detail::type_set<schema_qualified_table_as_t<TableSpec, NameTag>>;
 };
 
+template <typename TableSpec, typename NameTag>
+struct holds_sql_values<schema_qualified_table_as_t<TableSpec, NameTag>>
+    : public std::true_type {};
+
 template <typename Context, typename TableSpec, typename NameTag>
 auto to_sql_string(Context& context,
                    const schema_qualified_table_as_t<TableSpec, NameTag>& t)
@@ -60,6 +60,9 @@ struct provided_tables_of<verbatim_table_as_t<NameTag>> {
   using type = detail::type_set<verbatim_table_as_t<NameTag>>;
 };
 
+template <typename NameTag>
+struct holds_sql_values<verbatim_table_as_t<NameTag>> : std::true_type {};
+
 template <typename Context, typename NameTag>
 auto to_sql_string(Context& context, const verbatim_table_as_t<NameTag>& t)
     -> std::string {
@@ -88,6 +91,9 @@ struct verbatim_table_t : public enable_join {
 template <>
 struct is_table<verbatim_table_t> : std::true_type {};
 
+template <>
+struct holds_sql_values<verbatim_table_t> : std::true_type {};
+
 template <typename Context>
 auto to_sql_string(Context&, const verbatim_table_t& t) -> std::string {
   return t._representation;
@@ -67,12 +67,12 @@ struct delete_result_methods_t {
   }
 
   // Prepare
-  template <typename Statement, typename Db>
-  auto _prepare(this Statement&& self, Db& db)
+  template <typename Statement, typename Db, typename... Options>
+  auto _prepare(this Statement&& self, Db& db, Options... options)
       -> prepared_delete_t<Db, std::decay_t<Statement>> {
     return prepared_delete_t<Db, std::decay_t<Statement>>{
         statement_handler_t{}.prepare_delete_from(std::forward<Statement>(self),
-                                                  db)};
+                                                  db, options...)};
   }
 };
 
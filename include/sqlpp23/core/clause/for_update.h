@@ -27,26 +27,87 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <type_traits>
+
 #include <sqlpp23/core/detail/type_set.h>
 #include <sqlpp23/core/query/statement.h>
 #include <sqlpp23/core/type_traits.h>
 
 namespace sqlpp {
-struct for_update_t {};
+// Lock strengths
+struct lock_for_update_t {};
+struct lock_for_no_key_update_t {};
+struct lock_for_share_t {};
 
 template <typename Context>
-auto to_sql_string(Context&, const for_update_t&) -> std::string {
+auto to_sql_string(Context&, const lock_for_update_t&) -> std::string {
   return " FOR UPDATE";
 }
 
-template <>
-struct is_clause<for_update_t> : public std::true_type {};
+template <typename Context>
+auto to_sql_string(Context&, const lock_for_no_key_update_t&) -> std::string {
+  return " FOR NO KEY UPDATE";
+}
+
+template <typename Context>
+auto to_sql_string(Context&, const lock_for_share_t&) -> std::string {
+  return " FOR SHARE";
+}
 
-template <>
-struct contains_for_update<for_update_t> : public std::true_type {};
+// What to do about rows that are locked by other transactions.
+struct lock_wait_t {};
+struct lock_nowait_t {};
+struct lock_skip_locked_t {};
 
-template <typename Statement>
-struct consistency_check<Statement, for_update_t> {
+template <typename Context>
+auto to_sql_string(Context&, const lock_wait_t&) -> std::string {
+  return "";
+}
+
+template <typename Context>
+auto to_sql_string(Context&, const lock_nowait_t&) -> std::string {
+  return " NOWAIT";
+}
+
+template <typename Context>
+auto to_sql_string(Context&, const lock_skip_locked_t&) -> std::string {
+  return " SKIP LOCKED";
+}
+
+template <typename Strength, typename Wait>
+struct locking_t {
+  template <typename Statement>
+    requires(std::is_same_v<Wait, lock_wait_t>)
+  auto nowait(this Statement&& self) {
+    return new_statement<locking_t>(std::forward<Statement>(self),
+                                    locking_t<Strength, lock_nowait_t>{});
+  }
+
+  template <typename Statement>
+    requires(std::is_same_v<Wait, lock_wait_t>)
+  auto skip_locked(this Statement&& self) {
+    return new_statement<locking_t>(std::forward<Statement>(self),
+                                    locking_t<Strength, lock_skip_locked_t>{});
+  }
+};
+
+using for_update_t = locking_t<lock_for_update_t, lock_wait_t>;
+
+template <typename Context, typename Strength, typename Wait>
+auto to_sql_string(Context& context, const locking_t<Strength, Wait>&)
+    -> std::string {
+  return to_sql_string(context, Strength{}) + to_sql_string(context, Wait{});
+}
+
+template <typename Strength, typename Wait>
+struct is_clause<locking_t<Strength, Wait>> : public std::true_type {};
+
+template <typename Strength, typename Wait>
+struct contains_for_update<locking_t<Strength, Wait>>
+    : public std::true_type {};
+
+template <typename Statement, typename Strength, typename Wait>
+struct consistency_check<Statement, locking_t<Strength, Wait>> {
   using type = consistent_t;
   constexpr auto operator()() {
     return type{};
@@ -59,6 +120,20 @@ struct no_for_update_t {
     return new_statement<no_for_update_t>(std::forward<Statement>(self),
                                           for_update_t{});
   }
+
+  template <typename Statement>
+  auto for_no_key_update(this Statement&& self) {
+    return new_statement<no_for_update_t>(
+        std::forward<Statement>(self),
+        locking_t<lock_for_no_key_update_t, lock_wait_t>{});
+  }
+
+  template <typename Statement>
+  auto for_share(this Statement&& self) {
+    return new_statement<no_for_update_t>(
+        std::forward<Statement>(self),
+        locking_t<lock_for_share_t, lock_wait_t>{});
+  }
 };
 
 template <typename Context>
@@ -77,4 +152,12 @@ struct consistency_check<Statement, no_for_update_t> {
 inline auto for_update() {
   return statement_t<no_for_update_t>().for_update();
 }
+
+inline auto for_no_key_update() {
+  return statement_t<no_for_update_t>().for_no_key_update();
+}
+
+inline auto for_share() {
+  return statement_t<no_for_update_t>().for_share();
+}
 }  // namespace sqlpp
@@ -58,12 +58,12 @@ struct insert_result_methods_t {
   }
 
   // Prepare
-  template <typename Statement, typename Db>
-  auto _prepare(this Statement&& self, Db& db)
+  template <typename Statement, typename Db, typename... Options>
+  auto _prepare(this Statement&& self, Db& db, Options... options)
       -> prepared_insert_t<Db, std::decay_t<Statement>> {
     return prepared_insert_t<Db, std::decay_t<Statement>>{
         statement_handler_t{}.prepare_insert(std::forward<Statement>(self),
-                                             db)};
+                                             db, options...)};
   }
 };
 
@@ -35,6 +35,7 @@
 #include <sqlpp23/core/no_data.h>
 #include <sqlpp23/core/operator/assign_expression.h>
 #include <sqlpp23/core/query/dynamic.h>
+#include <sqlpp23/core/query/result_row_fwd.h>
 #include <sqlpp23/core/query/statement.h>
 #include <sqlpp23/core/reader.h>
 #include <sqlpp23/core/tuple_to_sql_string.h>
@@ -231,6 +232,28 @@ concept CorrectAddValuesAssignments = requires(Assignments... assignments) {
       get_rhs(std::move(assignments)))...};
 };
 
+namespace detail {
+// The result fields of a select need to be assignable to the columns of an
+// insert, in order.
+template <typename ResultRow, typename... Columns>
+struct is_insert_select_row_compatible : public std::false_type {};
+
+template <typename... FieldSpecs, typename... Columns>
+  requires(sizeof...(FieldSpecs) == sizeof...(Columns))
+struct is_insert_select_row_compatible<result_row_t<FieldSpecs...>, Columns...>
+    : public std::bool_constant<(
+          are_correct_assignment_args<Columns, FieldSpecs> and ...)> {};
+}  // namespace detail
+
+template <typename Select, typename... Columns>
+inline constexpr bool are_valid_insert_select_args =
+    is_statement<Select>::value and has_result_row<Select>::value and
+    detail::is_insert_select_row_compatible<get_result_row_t<Select>,
+                                            Columns...>::value;
+
+template <typename Select, typename... Columns>
+struct insert_select_t;
+
 template <typename... Columns>
 struct column_list_t {
   column_list_t(std::tuple<make_simple_column_t<Columns>...> columns)
@@ -252,6 +275,18 @@ struct column_list_t {
         get_rhs(std::move(assignments)))...);
   }
 
+  // Inserts the rows of a select instead of values. Rows that have been added
+  // via add_values() before are dropped.
+  template <typename Statement, typename Select>
+    requires(are_valid_insert_select_args<Select, Columns...>)
+  auto select(this Statement&& self, Select sub_select) {
+    auto new_clause = insert_select_t<Select, Columns...>{
+        static_cast<const column_list_t&>(self)._columns,
+        std::move(sub_select)};
+    return new_statement<column_list_t>(std::forward<Statement>(self),
+                                        std::move(new_clause));
+  }
+
  private:
   friend reader_t;
   std::tuple<make_simple_column_t<Columns>...> _columns;
@@ -314,6 +349,77 @@ struct nodes_of<column_list_t<Columns...>> {
   using type = detail::type_vector<Columns...>;
 };
 
+// The values of the inserted rows are not nodes.
+template <typename... Columns>
+struct holds_sql_values<column_list_t<Columns...>> : public std::true_type {};
+
+// INSERT INTO ... (columns) SELECT ...
+template <typename Select, typename... Columns>
+struct insert_select_t {
+  insert_select_t(std::tuple<make_simple_column_t<Columns>...> columns,
+                  Select sub_select)
+      : _columns(std::move(columns)), _expression(std::move(sub_select)) {}
+  insert_select_t(const insert_select_t&) = default;
+  insert_select_t(insert_select_t&&) = default;
+  insert_select_t& operator=(const insert_select_t&) = default;
+  insert_select_t& operator=(insert_select_t&&) = default;
+  ~insert_select_t() = default;
+
+ private:
+  friend reader_t;
+  std::tuple<make_simple_column_t<Columns>...> _columns;
+  Select _expression;
+};
+
+template <typename Context, typename Select, typename... Columns>
+auto to_sql_string(Context& context,
+                   const insert_select_t<Select, Columns...>& t) -> std::string {
+  auto result = std::string{" ("};
+  result += tuple_to_sql_string(context, read.columns(t),
+                                tuple_operand_no_dynamic{", "});
+  result += ") ";
+  return result + to_sql_string(context, read.expression(t));
+}
+
+template <typename Select, typename... Columns>
+struct is_clause<insert_select_t<Select, Columns...>> : public std::true_type {};
+
+template <typename Statement, typename Select, typename... Columns>
+struct consistency_check<Statement, insert_select_t<Select, Columns...>> {
+  using type = static_combined_check_t<
+      static_check_t<Statement::template _no_unknown_tables<
+                         insert_select_t<Select, Columns...>>,
+                     assert_no_unknown_tables_in_column_list_t>,
+      static_check_t<
+          detail::have_all_required_columns<Statement, Columns...>::value,
+          assert_all_required_columns_t>,
+      statement_consistency_check_t<Select>>;
+  constexpr auto operator()() {
+    return type{};
+  }
+};
+
+template <typename Statement, typename Select, typename... Columns>
+struct prepare_check<Statement, insert_select_t<Select, Columns...>> {
+  using type = statement_prepare_check_t<Select>;
+  constexpr auto operator()() {
+    return type{};
+  }
+};
+
+template <typename Statement, typename Select, typename... Columns>
+struct run_check<Statement, insert_select_t<Select, Columns...>> {
+  using type = statement_run_check_t<Select>;
+  constexpr auto operator()() {
+    return type{};
+  }
+};
+
+template <typename Select, typename... Columns>
+struct nodes_of<insert_select_t<Select, Columns...>> {
+  using type = detail::type_vector<Columns..., Select>;
+};
+
 class assert_insert_values_t : public wrapped_static_assert {
  public:
   template <typename... T>
@@ -0,0 +1,190 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <chrono>
+#include <string>
+#include <tuple>
+
+#include <sqlpp23/core/detail/type_set.h>
+#include <sqlpp23/core/reader.h>
+#include <sqlpp23/core/to_sql_string.h>
+#include <sqlpp23/core/tuple_to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+#include <sqlpp23/core/wrapped_static_assert.h>
+
+namespace sqlpp {
+template <typename T>
+struct is_optimizer_hint : public std::false_type {};
+
+// MAX_EXECUTION_TIME(milliseconds)
+struct max_execution_time_t {
+  std::chrono::milliseconds duration;
+};
+
+template <>
+struct is_optimizer_hint<max_execution_time_t> : public std::true_type {};
+
+template <typename Context>
+auto to_sql_string(Context&, const max_execution_time_t& t) -> std::string {
+  return "MAX_EXECUTION_TIME(" + std::to_string(t.duration.count()) + ")";
+}
+
+inline auto max_execution_time(std::chrono::milliseconds duration)
+    -> max_execution_time_t {
+  return {duration};
+}
+
+// JOIN_ORDER(table, ...)
+template <typename... Tables>
+struct join_order_t {};
+
+template <typename... Tables>
+struct is_optimizer_hint<join_order_t<Tables...>> : public std::true_type {};
+
+template <typename Context, typename Table, typename... Tables>
+auto to_sql_string(Context& context, const join_order_t<Table, Tables...>&)
+    -> std::string {
+  return "JOIN_ORDER(" + name_to_sql_string(context, name_tag_of_t<Table>{}) +
+         ((", " + name_to_sql_string(context, name_tag_of_t<Tables>{})) +
+          ... + "") +
+         ")";
+}
+
+template <typename... Tables>
+  requires(sizeof...(Tables) > 1 and
+           ((is_table_v<Tables> and has_name_tag_v<Tables>) and ...))
+auto join_order(const Tables&... /*unused*/) -> join_order_t<Tables...> {
+  return {};
+}
+
+// Optimizer hints are a select flag, e.g.
+// `SELECT /*+ MAX_EXECUTION_TIME(1000) */ tab_foo.id FROM tab_foo`.
+// They must be the first select flag.
+template <typename... Hints>
+struct optimizer_hints_t {
+  optimizer_hints_t(Hints... hints) : _expressions(std::move(hints)...) {}
+
+  optimizer_hints_t(const optimizer_hints_t&) = default;
+  optimizer_hints_t(optimizer_hints_t&&) = default;
+  optimizer_hints_t& operator=(const optimizer_hints_t&) = default;
+  optimizer_hints_t& operator=(optimizer_hints_t&&) = default;
+  ~optimizer_hints_t() = default;
+
+ private:
+  friend reader_t;
+  std::tuple<Hints...> _expressions;
+};
+
+template <typename... Hints>
+struct is_raw_select_flag<optimizer_hints_t<Hints...>>
+    : public std::true_type {};
+
+template <typename T>
+struct is_optimizer_hints : public std::false_type {};
+
+template <typename... Hints>
+struct is_optimizer_hints<optimizer_hints_t<Hints...>>
+    : public std::true_type {};
+
+template <typename... Hints>
+struct nodes_of<optimizer_hints_t<Hints...>> {
+  using type = detail::type_vector<Hints...>;
+};
+
+template <typename Context, typename... Hints>
+auto to_sql_string(Context& context, const optimizer_hints_t<Hints...>& t)
+    -> std::string {
+  return "/*+ " +
+         tuple_to_sql_string(context, read.expressions(t), tuple_clause{" "}) +
+         " */ ";
+}
+
+template <typename... Hints>
+  requires(sizeof...(Hints) > 0 and (is_optimizer_hint<Hints>::value and ...))
+auto optimizer_hints(Hints... hints) -> optimizer_hints_t<Hints...> {
+  return {std::move(hints)...};
+}
+
+class assert_join_order_tables_provided_t : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>,
+                  "join_order() must only name tables that are provided by "
+                  "the statement, e.g. via FROM");
+  }
+};
+
+namespace detail {
+template <typename Statement, typename Hint>
+struct optimizer_hint_check {
+  using type = consistent_t;
+};
+
+template <typename Statement, typename... Tables>
+struct optimizer_hint_check<Statement, join_order_t<Tables...>> {
+  using type =
+      static_check_t<Statement::_all_provided_tables::contains_all(
+                         type_set<Tables...>{}),
+                     assert_join_order_tables_provided_t>;
+};
+
+// Checks select flags. Only optimizer hints need to be checked against the
+// statement.
+template <typename Statement, typename Flag>
+struct select_flag_check {
+  using type = consistent_t;
+};
+
+template <typename Statement, typename Flag>
+struct select_flag_check<Statement, dynamic_t<Flag>>
+    : public select_flag_check<Statement, Flag> {};
+
+template <typename Statement, typename... Hints>
+struct select_flag_check<Statement, optimizer_hints_t<Hints...>> {
+  using type = static_combined_check_t<
+      typename optimizer_hint_check<Statement, Hints>::type...>;
+};
+
+template <typename Statement, typename Flag>
+using select_flag_check_t = typename select_flag_check<Statement, Flag>::type;
+
+// Optimizer hints have to follow the SELECT keyword directly.
+template <typename... Args>
+constexpr bool optimizer_hints_are_first() {
+  size_t index = 0;
+  bool misplaced = false;
+  ((misplaced = misplaced or
+                (index++ > 0 and
+                 is_optimizer_hints<remove_dynamic_t<Args>>::value)),
+   ...);
+  return not misplaced;
+}
+}  // namespace detail
+
+}  // namespace sqlpp
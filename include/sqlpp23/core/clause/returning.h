@@ -114,12 +114,12 @@ struct returning_column_list_result_methods_t {
   }
 
   // Prepare
-  template <typename Statement, typename Db>
-  auto _prepare(this Statement&& self, Db& db)
+  template <typename Statement, typename Db, typename... Options>
+  auto _prepare(this Statement&& self, Db& db, Options... options)
       -> prepared_select_t<Db, std::decay_t<Statement>> {
     return {make_parameter_list_t<std::decay_t<Statement>>{},
             statement_handler_t{}.prepare_select(std::forward<Statement>(self),
-                                                 db)};
+                                                 db, options...)};
   }
 };
 
@@ -78,7 +78,9 @@ inline constexpr blank_select_t select() {
 }
 
 template <DynamicSelectArg... Args>
-  requires(detail::count_columns<Args...>() > 0 and detail::all_flags_are_before_all_columns<Args...>())
+  requires(detail::count_columns<Args...>() > 0 and
+           detail::all_flags_are_before_all_columns<Args...>() and
+           detail::optimizer_hints_are_first<Args...>())
 auto select(Args... args) {
   return blank_select_t().columns(std::move(args)...);
 }
@@ -31,6 +31,7 @@
 
 #include <sqlpp23/core/basic/table.h>
 #include <sqlpp23/core/clause/expression_static_check.h>
+#include <sqlpp23/core/clause/optimizer_hints.h>
 #include <sqlpp23/core/clause/select_as.h>
 #include <sqlpp23/core/clause/select_column_traits.h>
 #include <sqlpp23/core/clause/select_columns_aggregate_check.h>
@@ -174,12 +175,12 @@ struct select_result_methods_t {
   }
 
   // Prepare
-  template <typename Statement, typename Db>
-  auto _prepare(this Statement&& self, Db& db)
+  template <typename Statement, typename Db, typename... Options>
+  auto _prepare(this Statement&& self, Db& db, Options... options)
       -> prepared_select_t<Db, std::decay_t<Statement>> {
     return prepared_select_t<Db, std::decay_t<Statement>>{
         statement_handler_t{}.prepare_select(std::forward<Statement>(self),
-                                             db)};
+                                             db, options...)};
   }
 };
 
@@ -203,6 +204,7 @@ struct consistency_check<
   static constexpr bool has_group_by = not AC::empty();
 
   using type = static_combined_check_t<
+      detail::select_flag_check_t<Statement, Flags>...,
       detail::select_columns_aggregate_check_t<
           has_group_by,
           Statement,
@@ -243,7 +245,7 @@ struct is_result_clause<
 template <typename... Flags, typename... Columns>
 struct nodes_of<
     select_column_list_t<std::tuple<Flags...>, std::tuple<Columns...>>> {
-  using type = detail::type_vector<Columns...>;
+  using type = detail::type_vector<Flags..., Columns...>;
 };
 
 class assert_columns_selected_t : public wrapped_static_assert {
@@ -267,7 +269,8 @@ using make_select_column_list_t =
 struct no_select_column_list_t {
   template <typename Statement, DynamicSelectArg... Args>
     requires(detail::count_columns<Args...>() > 0 and
-             detail::all_flags_are_before_all_columns<Args...>())
+             detail::all_flags_are_before_all_columns<Args...>() and
+             detail::optimizer_hints_are_first<Args...>())
   auto columns(this Statement&& self, Args... args) {
     return new_statement<no_select_column_list_t>(
         std::forward<Statement>(self),
@@ -293,7 +296,8 @@ struct consistency_check<Statement, no_select_column_list_t> {
 
 template <DynamicSelectArg... Args>
   requires(detail::count_columns<Args...>() > 0 and
-           detail::all_flags_are_before_all_columns<Args...>())
+           detail::all_flags_are_before_all_columns<Args...>() and
+           detail::optimizer_hints_are_first<Args...>())
 auto select_columns(Args... args) {
   return statement_t<no_select_column_list_t>().columns(std::move(args)...);
 }
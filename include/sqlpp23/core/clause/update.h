@@ -58,12 +58,12 @@ struct update_result_methods_t {
   }
 
   // Prepare
-  template <typename Statement, typename Db>
-  auto _prepare(this Statement&& self, Db& db)
+  template <typename Statement, typename Db, typename... Options>
+  auto _prepare(this Statement&& self, Db& db, Options... options)
       -> prepared_update_t<Db, std::decay_t<Statement>> {
     return prepared_update_t<Db, std::decay_t<Statement>>{
         statement_handler_t{}.prepare_update(std::forward<Statement>(self),
-                                             db)};
+                                             db, options...)};
   }
 };
 
@@ -0,0 +1,66 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+
+#include <sqlpp23/core/database/transaction.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp::detail {
+// Calls `function()` within a transaction, unless one is active already.
+template <typename Connection, typename Function>
+auto call_in_transaction(Connection& db, Function&& function)
+    -> decltype(function()) {
+  if (db.is_transaction_active()) {
+    return function();
+  }
+  auto transaction = start_transaction(db);
+  auto result = function();
+  transaction.commit();
+  return result;
+}
+
+// Executes `prepared` once per element of `rows`, see
+// docs/statement_execution.md. Each element is a tuple-like object with one
+// value per parameter, in the order in which the parameters appear in the
+// statement.
+template <typename Connection, typename PreparedStatement, typename Range>
+  requires(is_prepared_statement_v<PreparedStatement>)
+auto execute_many(Connection& db,
+                  PreparedStatement& prepared,
+                  const Range& rows) -> size_t {
+  return call_in_transaction(db, [&]() -> size_t {
+    size_t affected_rows = 0;
+    for (const auto& row : rows) {
+      prepared.parameters._set(row);
+      affected_rows += db(prepared).affected_rows;
+    }
+    return affected_rows;
+  });
+}
+}  // namespace sqlpp::detail
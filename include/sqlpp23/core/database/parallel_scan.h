@@ -0,0 +1,254 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/aggregate_function/max.h>
+#include <sqlpp23/core/aggregate_function/min.h>
+#include <sqlpp23/core/basic/column.h>
+#include <sqlpp23/core/clause/from.h>
+#include <sqlpp23/core/clause/select.h>
+#include <sqlpp23/core/detail/type_vector.h>
+#include <sqlpp23/core/name/common_aliases.h>
+#include <sqlpp23/core/reader.h>
+#include <sqlpp23/core/to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp {
+// Restricts a key column to the half-open range [lower, upper). A missing
+// bound leaves that side of the range open.
+template <typename Column, typename Value>
+struct key_range_t {
+  key_range_t(Column column,
+              std::optional<Value> lower,
+              std::optional<Value> upper)
+      : _lhs(std::move(column)), _rhs(std::move(lower), std::move(upper)) {}
+  key_range_t(const key_range_t&) = default;
+  key_range_t(key_range_t&&) = default;
+  key_range_t& operator=(const key_range_t&) = default;
+  key_range_t& operator=(key_range_t&&) = default;
+  ~key_range_t() = default;
+
+ private:
+  friend reader_t;
+  Column _lhs;
+  std::pair<std::optional<Value>, std::optional<Value>> _rhs;
+};
+
+template <typename Column, typename Value>
+struct data_type_of<key_range_t<Column, Value>> {
+  using type = boolean;
+};
+
+template <typename Column, typename Value>
+struct nodes_of<key_range_t<Column, Value>> {
+  using type = detail::type_vector<Column>;
+};
+
+template <typename Column, typename Value>
+struct holds_sql_values<key_range_t<Column, Value>> : public std::true_type {};
+
+template <typename Context, typename Column, typename Value>
+auto to_sql_string(Context& context, const key_range_t<Column, Value>& t)
+    -> std::string {
+  const auto& [lower, upper] = read.rhs(t);
+  if (not lower and not upper) {
+    return to_sql_string(context, true);
+  }
+  const auto column = operand_to_sql_string(context, read.lhs(t));
+  auto ret = std::string{"("};
+  if (lower) {
+    ret += column + " >= " + to_sql_string(context, *lower);
+  }
+  if (lower and upper) {
+    ret += " AND ";
+  }
+  if (upper) {
+    ret += column + " < " + to_sql_string(context, *upper);
+  }
+  return ret + ")";
+}
+
+// The key ranges of a parallel scan, see docs/connection_pool.md.
+//
+// `n` sorted and distinct split points yield n + 1 ranges:
+//   key < s0, s0 <= key < s1, ..., s(n-1) <= key
+template <typename Column, typename Value>
+auto key_ranges(const Column& key, std::vector<Value> split_points)
+    -> std::vector<key_range_t<Column, Value>> {
+  static_assert(not can_be_null<Column>::value,
+                "parallel_scan requires a non-nullable key");
+  std::sort(split_points.begin(), split_points.end());
+  split_points.erase(std::unique(split_points.begin(), split_points.end()),
+                     split_points.end());
+
+  auto ranges = std::vector<key_range_t<Column, Value>>{};
+  ranges.reserve(split_points.size() + 1);
+  auto lower = std::optional<Value>{};
+  for (auto& split_point : split_points) {
+    ranges.emplace_back(key, lower, split_point);
+    lower = std::move(split_point);
+  }
+  ranges.emplace_back(key, std::move(lower), std::nullopt);
+  return ranges;
+}
+
+// Runs `make_statement(range)` for each key range concurrently, each on its
+// own connection from `pool`, and calls `consume(partition_index, row)` for
+// every row.
+//
+// Rows of the same partition are consumed sequentially and in result order.
+// Different partitions are consumed concurrently, so `consume` has to be safe
+// to call from several threads at once for different partition indexes. If
+// the statement orders by the key, concatenating the per-partition output in
+// partition order yields the rows in key order.
+//
+// If a statement or a call of `consume` throws, the remaining partitions stop
+// early and the exception of the lowest failing partition is rethrown once
+// all threads have finished.
+template <typename Pool,
+          typename Column,
+          typename Value,
+          typename MakeStatement,
+          typename Consume>
+void parallel_scan(Pool& pool,
+                   const Column& key,
+                   std::vector<Value> split_points,
+                   MakeStatement make_statement,
+                   Consume&& consume) {
+  const auto ranges = key_ranges(key, std::move(split_points));
+  auto errors = std::vector<std::exception_ptr>(ranges.size());
+  auto stop = std::atomic<bool>{false};
+
+  const auto scan = [&](size_t partition) {
+    try {
+      auto db = pool.get();
+      for (const auto& row : db(make_statement(ranges[partition]))) {
+        if (stop.load(std::memory_order_relaxed)) {
+          return;
+        }
+        consume(partition, row);
+      }
+    } catch (...) {
+      errors[partition] = std::current_exception();
+      stop = true;
+    }
+  };
+
+  // The first partition runs on the calling thread.
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(ranges.size() - 1);
+  try {
+    for (size_t partition = 1; partition < ranges.size(); ++partition) {
+      threads.emplace_back(scan, partition);
+    }
+  } catch (...) {
+    stop = true;
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    throw;
+  }
+  scan(0);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+namespace detail {
+// `partitions - 1` split points of equal width between `min` and `max`.
+inline std::vector<int64_t> equal_width_split_points(int64_t min,
+                                                     int64_t max,
+                                                     size_t partitions) {
+  auto split_points = std::vector<int64_t>{};
+  if (partitions < 2 or min >= max) {
+    return split_points;
+  }
+  // Unsigned arithmetic cannot overflow for the full range of int64_t.
+  const auto base = static_cast<uint64_t>(min);
+  const auto span = static_cast<uint64_t>(max) - base;
+  const auto count = static_cast<uint64_t>(partitions);
+  split_points.reserve(partitions - 1);
+  for (uint64_t i = 1; i < count; ++i) {
+    const auto offset = span / count * i + span % count * i / count;
+    const auto split_point = static_cast<int64_t>(base + offset);
+    if (split_point > min and
+        (split_points.empty() or split_point > split_points.back())) {
+      split_points.push_back(split_point);
+    }
+  }
+  return split_points;
+}
+}  // namespace detail
+
+// Like above, but splits the range between the minimum and the maximum of an
+// integral key into `partitions` ranges of equal width. Does nothing if the
+// table is empty.
+template <typename Pool,
+          typename Column,
+          typename MakeStatement,
+          typename Consume>
+  requires(is_integral<Column>::value)
+void parallel_scan(Pool& pool,
+                   const Column& key,
+                   size_t partitions,
+                   MakeStatement make_statement,
+                   Consume&& consume) {
+  auto split_points = std::vector<int64_t>{};
+  {
+    auto db = pool.get();
+    auto result = db(select(min(key).as(alias::a), max(key).as(alias::b))
+                         .from(table_of_t<Column>{}));
+    const auto& row = result.front();
+    if (not row.a.has_value()) {
+      return;
+    }
+    split_points = detail::equal_width_split_points(
+        static_cast<int64_t>(*row.a), static_cast<int64_t>(*row.b),
+        partitions);
+  }
+  parallel_scan(pool, key, std::move(split_points), std::move(make_statement),
+                std::forward<Consume>(consume));
+}
+}  // namespace sqlpp
@@ -27,15 +27,167 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <sqlpp23/core/detail/type_vector.h>
 #include <sqlpp23/core/query/bind_parameter.h>
 #include <sqlpp23/core/type_traits.h>
+#include <sqlpp23/core/type_traits/optional.h>
 #include <sqlpp23/core/wrong.h>
 
 namespace sqlpp {
+namespace detail {
+inline void hash_combine(size_t& seed, size_t hash) {
+  seed ^= hash + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+}
+
+// Hashes the contents of a parameter value together with the addresses of
+// its buffers, since MySQL and sqlite3 bind pointers into parameter values.
+template <typename T>
+size_t parameter_hash(const T& value) {
+  if constexpr (is_optional<T>::value) {
+    return value.has_value() ? parameter_hash(*value) + 1 : 0;
+  } else if constexpr (std::is_trivially_copyable_v<T>) {
+    return std::hash<std::string_view>{}(std::string_view{
+        reinterpret_cast<const char*>(&value), sizeof(value)});
+  } else {
+    // Strings, blobs and array parameters.
+    auto seed = std::hash<const void*>{}(value.data());
+    hash_combine(seed, value.size());
+    using element_t = std::decay_t<decltype(*value.data())>;
+    if constexpr (std::is_trivially_copyable_v<element_t>) {
+      hash_combine(seed, std::hash<std::string_view>{}(std::string_view{
+                             reinterpret_cast<const char*>(value.data()),
+                             value.size() * sizeof(element_t)}));
+    } else {
+      for (const auto& element : value) {
+        hash_combine(seed, parameter_hash(element));
+      }
+    }
+    return seed;
+  }
+}
+
+// Calls `f` with the address of each buffer of a parameter value, since MySQL
+// and sqlite3 bind pointers into parameter values.
+template <typename T, typename F>
+void for_each_parameter_buffer(const T& value, const F& f) {
+  if constexpr (is_optional<T>::value) {
+    if (value.has_value()) {
+      for_each_parameter_buffer(*value, f);
+    }
+  } else if constexpr (requires { value.data(); }) {
+    f(static_cast<const void*>(value.data()));
+    using element_t = std::decay_t<decltype(*value.data())>;
+    if constexpr (not std::is_trivially_copyable_v<element_t>) {
+      for (const auto& element : value) {
+        for_each_parameter_buffer(element, f);
+      }
+    }
+  }
+}
+
+// Remembers what was last bound for a parameter, so that unchanged parameters
+// need not be bound again. Parameter members are plain values that can be
+// modified in place, so there is no assignment operator to set a dirty flag.
+//
+// Trivially copyable values (numbers, dates, etc.) are compared to a copy.
+// Other values (strings, blobs, array parameters) are compared to a copy, too,
+// and to the addresses of their buffers. A hash of both is only used to detect
+// changes quickly. The copy and the list of addresses are assigned to, so they
+// do not allocate once their capacity suffices.
+//
+// Copies and moves start out unbound: some connectors bind pointers into the
+// parameter values and those change with the parameter list.
+template <typename Value>
+class bound_parameter_t {
+ public:
+  bound_parameter_t() = default;
+  bound_parameter_t(const bound_parameter_t&) {}
+  bound_parameter_t(bound_parameter_t&&) {}
+  bound_parameter_t& operator=(const bound_parameter_t&) {
+    _is_bound = false;
+    return *this;
+  }
+  bound_parameter_t& operator=(bound_parameter_t&&) {
+    _is_bound = false;
+    return *this;
+  }
+  ~bound_parameter_t() = default;
+
+  bool is_bound(const Value& value) const {
+    if (not _is_bound) {
+      return false;
+    }
+    if constexpr (_compare_values) {
+      return _copy == value;
+    } else {
+      if (parameter_hash(value) != _hash) {
+        return false;
+      }
+      const auto* v = value_of(value);
+      if (v == nullptr) {
+        return not _has_value;
+      }
+      return _has_value and _copy == *v and has_same_buffers(*v);
+    }
+  }
+
+  void set(const Value& value) {
+    if constexpr (_compare_values) {
+      _copy = value;
+    } else {
+      _hash = parameter_hash(value);
+      _buffers.clear();
+      const auto* v = value_of(value);
+      _has_value = v != nullptr;
+      if (_has_value) {
+        _copy.assign(v->begin(), v->end());
+        for_each_parameter_buffer(
+            *v, [this](const void* buffer) { _buffers.push_back(buffer); });
+      }
+    }
+    _is_bound = true;
+  }
+
+ private:
+  static constexpr bool _compare_values = std::is_trivially_copyable_v<Value>;
+  using _copy_t =
+      std::conditional_t<_compare_values, Value, remove_optional_t<Value>>;
+
+  static auto value_of(const Value& value) -> const _copy_t* {
+    if constexpr (is_optional<Value>::value) {
+      return value.has_value() ? &*value : nullptr;
+    } else {
+      return &value;
+    }
+  }
+
+  bool has_same_buffers(const _copy_t& value) const {
+    size_t index = 0;
+    bool same = true;
+    for_each_parameter_buffer(value, [&](const void* buffer) {
+      same = same and index < _buffers.size() and _buffers[index] == buffer;
+      ++index;
+    });
+    return same and index == _buffers.size();
+  }
+
+  bool _is_bound = false;
+  bool _has_value = false;
+  size_t _hash = 0;
+  _copy_t _copy{};
+  std::vector<const void*> _buffers;
+};
+}  // namespace detail
+
 template <typename T>
 struct parameter_list_t {
   static_assert(
@@ -51,20 +203,58 @@ struct parameter_list_t<detail::type_vector<Parameter...>>
 
   parameter_list_t() = default;
 
+  // Assigns the elements of a tuple-like object to the parameters, in the
+  // order in which the parameters appear in the statement.
+  template <typename Tuple>
+    requires(std::tuple_size<Tuple>::value == size::value)
+  void _set(const Tuple& values) {
+    _set_impl(values, std::make_index_sequence<size::value>{});
+  }
+
+  // Binds the parameters that changed since the previous call. Bindings are
+  // expected to persist in the target between executions.
   template <typename Target>
-  void _bind(Target& target) const {
+  void _bind(Target& target) {
     _bind_impl(target, std::make_index_sequence<size::value>{});
   }
 
  private:
+  template <typename Tuple, size_t... Is>
+  void _set_impl(const Tuple& values,
+                 const std::index_sequence<Is...>& /*unused*/) {
+    using std::get;
+    ((std::tuple_element<Is, _member_tuple_t>::type::operator()() =
+          get<Is>(values)),
+     ...);
+  }
+
   template <typename Target, size_t... Is>
   void _bind_impl(Target& target,
-                  const std::index_sequence<Is...>& /*unused*/) const {
-    (bind_parameter(
-         target, Is,
-         std::tuple_element<Is, _member_tuple_t>::type::operator()()),
+                  const std::index_sequence<Is...>& /*unused*/) {
+    // Array parameters may occupy more than one placeholder.
+    size_t placeholder_index = 0;
+    ((placeholder_index = _bind_one(
+          target, placeholder_index,
+          std::tuple_element<Is, _member_tuple_t>::type::operator()(),
+          std::get<Is>(_bound_values))),
      ...);
   }
+
+  template <typename Target, typename Value>
+  static size_t _bind_one(Target& target,
+                          size_t placeholder_index,
+                          const Value& value,
+                          detail::bound_parameter_t<Value>& bound_value) {
+    if (not bound_value.is_bound(value)) {
+      bind_parameter(target, placeholder_index, value);
+      bound_value.set(value);
+    }
+    return placeholder_index + placeholder_count<Target, Value>::value;
+  }
+
+  std::tuple<detail::bound_parameter_t<
+      std::decay_t<decltype(std::declval<typename Parameter::_instance_t>()())>>...>
+      _bound_values;
 };
 
 template <typename Exp>
@@ -0,0 +1,477 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/basic/schema_qualified_table.h>
+#include <sqlpp23/core/basic/table.h>
+#include <sqlpp23/core/basic/table_as.h>
+#include <sqlpp23/core/clause/delete_from.h>
+#include <sqlpp23/core/clause/insert.h>
+#include <sqlpp23/core/clause/update.h>
+#include <sqlpp23/core/clause/with.h>
+#include <sqlpp23/core/database/transaction.h>
+#include <sqlpp23/core/query/statement.h>
+#include <sqlpp23/core/query/to_vector.h>
+#include <sqlpp23/core/to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp {
+namespace detail {
+// The tables that a statement reads or writes. In contrast to
+// `provided_tables_of`, this also traverses into sub queries and CTEs.
+template <typename T>
+struct touched_tables_of;
+
+template <typename T>
+using touched_tables_of_t = typename touched_tables_of<T>::type;
+
+template <typename T>
+struct touched_tables_of {
+  using type = make_joined_set_t<provided_tables_of_t<T>,
+                                 touched_tables_of_t<nodes_of_t<T>>>;
+};
+
+template <typename... T>
+struct touched_tables_of<type_vector<T...>> {
+  using type = make_joined_set_t<touched_tables_of_t<T>...>;
+};
+
+template <typename... Clauses>
+struct touched_tables_of<statement_t<Clauses...>> {
+  using type = make_joined_set_t<touched_tables_of_t<Clauses>...>;
+};
+
+template <typename... Ctes>
+struct touched_tables_of<with_t<Ctes...>> {
+  using type = make_joined_set_t<touched_tables_of_t<Ctes>...>;
+};
+
+// Aliases of a table are the same table as far as the cache is concerned.
+template <typename Table>
+struct cached_table_id {
+  using type = Table;
+};
+
+template <typename TableSpec>
+struct cached_table_id<table_t<TableSpec>> {
+  using type = TableSpec;
+};
+
+template <typename TableSpec, typename NameTag>
+struct cached_table_id<table_as_t<TableSpec, NameTag>> {
+  using type = TableSpec;
+};
+
+template <typename TableSpec, typename NameTag>
+struct cached_table_id<schema_qualified_table_as_t<TableSpec, NameTag>> {
+  using type = TableSpec;
+};
+
+template <typename... Tables>
+auto cached_table_ids(type_set<Tables...>) -> std::vector<std::type_index> {
+  return {typeid(typename cached_table_id<Tables>::type)...};
+}
+
+template <typename T>
+struct is_cacheable_select : public std::false_type {};
+
+// Statements with RETURNING have a result row, too, but they modify data.
+template <typename... Clauses>
+struct is_cacheable_select<statement_t<Clauses...>>
+    : public std::bool_constant<
+          has_result_row<statement_t<Clauses...>>::value and
+          not contains_for_update_v<statement_t<Clauses...>> and
+          not(std::is_same_v<Clauses, insert_t> or ...) and
+          not(std::is_same_v<Clauses, update_t> or ...) and
+          not(std::is_same_v<Clauses, delete_t> or ...)> {};
+
+template <typename T>
+inline constexpr bool is_cacheable_select_v = is_cacheable_select<T>::value;
+}  // namespace detail
+
+struct result_cache_config {
+  // Entries older than this are executed again.
+  std::chrono::steady_clock::duration ttl = std::chrono::seconds{60};
+  // Least recently used entries are evicted once the cached rows exceed this.
+  size_t max_bytes = size_t{16} << 20;
+};
+
+// A snapshot of the rows of a cached select. Text and blob fields point into
+// memory owned by the snapshot, i.e. they remain valid for as long as the
+// snapshot lives, even if its cache entry is evicted or invalidated.
+template <typename Row>
+class cached_rows_t {
+  using _rows_t = std::pmr::vector<Row>;
+
+ public:
+  explicit cached_rows_t(std::shared_ptr<const _rows_t> rows)
+      : _rows(std::move(rows)) {}
+
+  auto begin() const { return _rows->begin(); }
+  auto end() const { return _rows->end(); }
+  auto size() const -> size_t { return _rows->size(); }
+  auto empty() const -> bool { return _rows->empty(); }
+  auto front() const -> const Row& { return _rows->front(); }
+  auto operator[](size_t i) const -> const Row& { return (*_rows)[i]; }
+
+ private:
+  std::shared_ptr<const _rows_t> _rows;
+};
+
+// Caches the rows of select statements, keyed by statement type and
+// serialized SQL (i.e. including all values). Entries are invalidated by
+// insert, update and delete statements that are executed via a
+// cached_connection and that touch one of the tables read by the select.
+//
+// Changes that bypass the cache (other clients, triggers, statements that are
+// executed directly or as prepared statements) are only picked up after
+// `ttl` or an explicit invalidate().
+//
+// The cache can be shared between threads and between connections, as long
+// as they are connected to the same database.
+class result_cache {
+ public:
+  explicit result_cache(result_cache_config config = {}) : _config(config) {}
+  result_cache(const result_cache&) = delete;
+  result_cache(result_cache&&) = delete;
+  result_cache& operator=(const result_cache&) = delete;
+  result_cache& operator=(result_cache&&) = delete;
+  ~result_cache() = default;
+
+  template <typename Db, typename Statement>
+    requires(detail::is_cacheable_select_v<Statement>)
+  auto select(Db& db, const Statement& statement) {
+    return _select(db, statement, /*use_cache*/ true);
+  }
+
+  // Drops all entries that read from any of the given tables.
+  template <typename... Tables>
+    requires(sizeof...(Tables) > 0 and (is_table_v<Tables> and ...))
+  void invalidate(const Tables&...) {
+    _invalidate({typeid(typename detail::cached_table_id<Tables>::type)...});
+  }
+
+  // Drops all entries that read from any of the tables touched by
+  // `statement`.
+  template <typename Statement>
+    requires(is_statement_v<Statement>)
+  void invalidate(const Statement&) {
+    _invalidate(
+        detail::cached_table_ids(detail::touched_tables_of_t<Statement>{}));
+  }
+
+  void clear() {
+    const auto lock = std::lock_guard{_mutex};
+    ++_generation;
+    _entries.clear();
+    _lru.clear();
+    _bytes = 0;
+  }
+
+  auto size() const -> size_t {
+    const auto lock = std::lock_guard{_mutex};
+    return _entries.size();
+  }
+
+  // The memory held by the cached rows.
+  auto bytes() const -> size_t {
+    const auto lock = std::lock_guard{_mutex};
+    return _bytes;
+  }
+
+ private:
+  // Counts the memory requested by an entry's arena.
+  class counting_resource : public std::pmr::memory_resource {
+   public:
+    auto allocated() const -> size_t { return _allocated; }
+
+   private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+      auto* p = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+      _allocated += bytes;
+      return p;
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+      std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+      _allocated -= bytes;
+    }
+    bool do_is_equal(
+        const std::pmr::memory_resource& other) const noexcept override {
+      return this == &other;
+    }
+
+    size_t _allocated = 0;
+  };
+
+  template <typename Row>
+  using _rows_t = std::pmr::vector<Row>;
+
+  struct entry_base_t {
+    virtual ~entry_base_t() = default;
+  };
+
+  template <typename Row>
+  struct entry_t : public entry_base_t {
+    counting_resource upstream;
+    std::pmr::monotonic_buffer_resource arena{&upstream};
+    std::pmr::vector<Row> rows{&arena};
+  };
+
+  struct key_t {
+    std::type_index statement;
+    std::string sql;
+
+    bool operator==(const key_t&) const = default;
+  };
+
+  struct key_hash {
+    size_t operator()(const key_t& key) const {
+      return key.statement.hash_code() * 31 +
+             std::hash<std::string_view>{}(key.sql);
+    }
+  };
+
+  struct slot_t {
+    std::shared_ptr<const entry_base_t> rows;
+    std::vector<std::type_index> tables;
+    std::chrono::steady_clock::time_point expires;
+    size_t bytes;
+    std::list<key_t>::iterator lru;
+  };
+
+  using _entries_t = std::unordered_map<key_t, slot_t, key_hash>;
+
+  template <typename Connection>
+  friend class cached_connection;
+
+  template <typename Db, typename Statement>
+  auto _select(Db& db, const Statement& statement, bool use_cache) {
+    using _row_t = std::remove_cvref_t<decltype(db(statement).front())>;
+    using _entry_t = entry_t<_row_t>;
+
+    if (not use_cache) {
+      auto entry = std::make_shared<_entry_t>();
+      entry->rows = to_vector(db(statement), entry->arena);
+      return cached_rows_t<_row_t>{
+          std::shared_ptr<const _rows_t<_row_t>>{entry, &entry->rows}};
+    }
+
+    auto key = key_t{typeid(Statement), _to_sql_string(db, statement)};
+    uint64_t generation = 0;
+    {
+      const auto lock = std::lock_guard{_mutex};
+      if (auto it = _entries.find(key); it != _entries.end()) {
+        if (std::chrono::steady_clock::now() < it->second.expires) {
+          _lru.splice(_lru.begin(), _lru, it->second.lru);
+          const auto& entry = static_cast<const _entry_t&>(*it->second.rows);
+          return cached_rows_t<_row_t>{std::shared_ptr<const _rows_t<_row_t>>{
+              it->second.rows, &entry.rows}};
+        }
+        _erase(it);
+      }
+      generation = _generation;
+    }
+
+    // Run the query without holding the lock.
+    auto entry = std::make_shared<_entry_t>();
+    entry->rows = to_vector(db(statement), entry->arena);
+    const auto bytes = entry->upstream.allocated() + key.sql.size();
+    auto rows = std::shared_ptr<const _rows_t<_row_t>>{entry, &entry->rows};
+
+    if (bytes <= _config.max_bytes) {
+      const auto lock = std::lock_guard{_mutex};
+      // The rows might predate an invalidation that happened while the query
+      // was running.
+      if (_generation != generation) {
+        return cached_rows_t<_row_t>{std::move(rows)};
+      }
+      if (auto it = _entries.find(key); it != _entries.end()) {
+        _erase(it);
+      }
+      _lru.push_front(key);
+      _entries.emplace(std::move(key),
+                       slot_t{std::move(entry),
+                              detail::cached_table_ids(
+                                  detail::touched_tables_of_t<Statement>{}),
+                              std::chrono::steady_clock::now() + _config.ttl,
+                              bytes, _lru.begin()});
+      _bytes += bytes;
+      while (_bytes > _config.max_bytes) {
+        _erase(_entries.find(_lru.back()));
+      }
+    }
+    return cached_rows_t<_row_t>{std::move(rows)};
+  }
+
+  template <typename Db, typename Statement>
+  static auto _to_sql_string(Db& db, const Statement& statement)
+      -> std::string {
+    using _context_t = typename Db::_context_t;
+    using ::sqlpp::to_sql_string;
+    if constexpr (std::is_constructible_v<_context_t, Db*>) {
+      _context_t context{&db};
+      return to_sql_string(context, statement);
+    } else {
+      _context_t context{};
+      return to_sql_string(context, statement);
+    }
+  }
+
+  void _erase(typename _entries_t::iterator it) {
+    _bytes -= it->second.bytes;
+    _lru.erase(it->second.lru);
+    _entries.erase(it);
+  }
+
+  void _invalidate(const std::vector<std::type_index>& tables) {
+    const auto lock = std::lock_guard{_mutex};
+    ++_generation;
+    for (auto it = _entries.begin(); it != _entries.end();) {
+      const auto& touched = it->second.tables;
+      if (std::ranges::find_first_of(touched, tables) != touched.end()) {
+        _erase(it++);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  const result_cache_config _config;
+  mutable std::mutex _mutex;
+  _entries_t _entries;
+  std::list<key_t> _lru;
+  size_t _bytes = 0;
+  // Incremented by every invalidation. Rows of queries that ran while it
+  // changed are returned, but not cached.
+  uint64_t _generation = 0;
+};
+
+// Wraps a connection. Select statements are answered from `cache`, all other
+// statements are executed and invalidate the cache entries of the tables they
+// touch. Within a transaction that modified data, selects bypass the cache and
+// the modified tables are invalidated again on commit and rollback. Start
+// transactions on the cached_connection for this to work. See docs/select.md.
+template <typename Connection>
+class cached_connection {
+ public:
+  cached_connection(Connection& db, result_cache& cache)
+      : _db(db), _cache(cache) {}
+
+  template <typename T>
+    requires(is_statement_v<T>)
+  auto operator()(const T& t) {
+    if constexpr (detail::is_cacheable_select_v<T>) {
+      return _cache._select(_db, t, not _has_uncommitted_writes());
+    } else {
+      auto result = _db(t);
+      const auto tables =
+          detail::cached_table_ids(detail::touched_tables_of_t<T>{});
+      _cache._invalidate(tables);
+      if (_db.is_transaction_active()) {
+        _written_tables.insert(_written_tables.end(), tables.begin(),
+                               tables.end());
+      }
+      return result;
+    }
+  }
+
+  // The cache cannot know which tables are affected by verbatim statements.
+  auto operator()(std::string_view statement) {
+    auto result = _db(statement);
+    _cache.clear();
+    if (_db.is_transaction_active()) {
+      _written_unknown = true;
+    }
+    return result;
+  }
+
+  void start_transaction() { _db.start_transaction(); }
+
+  void start_transaction(isolation_level level) {
+    _db.start_transaction(level);
+  }
+
+  void commit_transaction() {
+    _db.commit_transaction();
+    _invalidate_written();
+  }
+
+  void rollback_transaction() {
+    _db.rollback_transaction();
+    _invalidate_written();
+  }
+
+  void report_rollback_failure(const std::string& message) {
+    _db.report_rollback_failure(message);
+  }
+
+  bool is_transaction_active() { return _db.is_transaction_active(); }
+
+  auto connection() -> Connection& { return _db; }
+  auto cache() -> result_cache& { return _cache; }
+
+ private:
+  bool _has_uncommitted_writes() {
+    return _db.is_transaction_active() and
+           (_written_unknown or not _written_tables.empty());
+  }
+
+  // Concurrent readers might have cached the data from before the commit.
+  void _invalidate_written() {
+    if (_written_unknown) {
+      _cache.clear();
+    } else if (not _written_tables.empty()) {
+      _cache._invalidate(_written_tables);
+    }
+    _written_tables.clear();
+    _written_unknown = false;
+  }
+
+  Connection& _db;
+  result_cache& _cache;
+  std::vector<std::type_index> _written_tables;
+  bool _written_unknown = false;
+};
+}  // namespace sqlpp
@@ -0,0 +1,301 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+
+#include <sqlpp23/core/database/exception.h>
+#include <sqlpp23/core/query/dynamic_fwd.h>
+#include <sqlpp23/core/query/statement_fwd.h>
+#include <sqlpp23/core/reader.h>
+#include <sqlpp23/core/to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+#include <sqlpp23/core/wrapped_static_assert.h>
+
+namespace sqlpp {
+namespace detail {
+template <typename T>
+struct contains_dynamic;
+
+template <typename T>
+inline constexpr bool contains_dynamic_v = contains_dynamic<T>::value;
+
+template <typename T>
+struct contains_dynamic
+    : public std::bool_constant<is_dynamic<T>::value or
+                                contains_dynamic_v<nodes_of_t<T>>> {};
+
+template <typename... T>
+struct contains_dynamic<type_vector<T...>>
+    : public std::bool_constant<(contains_dynamic_v<T> or ...)> {};
+
+template <typename... T>
+struct contains_dynamic<std::tuple<T...>>
+    : public std::bool_constant<(contains_dynamic_v<T> or ...)> {};
+
+// Sub queries are no nodes of their enclosing statement.
+template <typename... Clauses>
+struct contains_dynamic<statement_t<Clauses...>>
+    : public std::bool_constant<(contains_dynamic_v<Clauses> or ...)> {};
+
+// True if the SQL text of T is determined by its type and its dynamic shape,
+// i.e. the only values it holds are parameters.
+template <typename T>
+struct has_parameters_only;
+
+template <typename T>
+inline constexpr bool has_parameters_only_v = has_parameters_only<T>::value;
+
+// Leaves must not hold values, e.g. a literal `5` or the text of a verbatim.
+// Tables hold their columns, which do not count as values.
+template <typename T>
+inline constexpr bool is_value_free_leaf_v =
+    std::is_empty_v<T> or is_table_v<T> or not parameters_of_t<T>::empty();
+
+template <typename T>
+struct has_parameters_only
+    : public std::bool_constant<
+          not holds_sql_values<T>::value and
+          (nodes_of_t<T>::empty() ? is_value_free_leaf_v<T>
+                                  : has_parameters_only_v<nodes_of_t<T>>)> {};
+
+template <typename... T>
+struct has_parameters_only<type_vector<T...>>
+    : public std::bool_constant<(has_parameters_only_v<T> and ...)> {};
+
+// Sub queries are no nodes of their enclosing statement.
+template <typename... Clauses>
+struct has_parameters_only<statement_t<Clauses...>>
+    : public std::bool_constant<(has_parameters_only_v<Clauses> and ...)> {};
+
+// Sets one bit per `dynamic` node in traversal order. Nodes inside absent
+// `dynamic` nodes are skipped, so the traversal order (and thus the meaning
+// of each bit) only depends on the bits that precede it.
+class dynamic_shape_builder {
+ public:
+  template <typename T>
+  void add(const T& t) {
+    if constexpr (not contains_dynamic_v<T>) {
+      return;
+    } else if constexpr (is_dynamic<T>::value) {
+      if (_index == 64) {
+        throw exception{"dynamic_shape: more than 64 dynamic expressions"};
+      }
+      if (t.has_value()) {
+        _shape |= uint64_t{1} << _index;
+      }
+      ++_index;
+      if (t.has_value()) {
+        add(t.value());
+      }
+    } else if constexpr (is_statement<T>::value) {
+      _add_clauses(t);
+    } else if constexpr (requires { std::tuple_size<T>::value; }) {
+      std::apply([this](const auto&... elements) { (add(elements), ...); },
+                 t);
+    } else {
+      static_assert(reader_t::has_operands<T>,
+                    "dynamic_shape: cannot find the dynamic parts of this "
+                    "expression");
+      read.for_each_operand(t,
+                            [this](const auto& operand) { add(operand); });
+    }
+  }
+
+  auto shape() const -> uint64_t { return _shape; }
+
+ private:
+  template <typename... Clauses>
+  void _add_clauses(const statement_t<Clauses...>& t) {
+    (add(static_cast<const Clauses&>(t)), ...);
+  }
+
+  uint64_t _shape = 0;
+  size_t _index = 0;
+};
+}  // namespace detail
+
+// The combination of `dynamic` parts that are present in `statement`, i.e.
+// together with the statement type, this determines its SQL text.
+template <typename Statement>
+  requires(is_statement<Statement>::value)
+auto dynamic_shape(const Statement& statement) -> uint64_t {
+  auto builder = detail::dynamic_shape_builder{};
+  builder.add(statement);
+  return builder.shape();
+}
+
+class assert_parameters_only_t : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>,
+                  "only statements without literal values (e.g. `tab.id == "
+                  "5`, `limit(10)` or verbatim text) can be cached, use "
+                  "parameters instead");
+  }
+};
+
+template <typename Statement>
+using serialization_cache_check_t =
+    static_check_t<detail::has_parameters_only_v<Statement>,
+                   assert_parameters_only_t>;
+
+// Memoizes serialized statements by statement type and shape (see
+// dynamic_shape()), which is derived from the statement.
+//
+// This is only correct if the SQL text is fully determined by type and shape,
+// which is why only statements without values other than parameters are
+// accepted (see serialization_cache_check_t). The cache can be shared between
+// connections of the same connector and between threads.
+class serialization_cache {
+ public:
+  serialization_cache() = default;
+  serialization_cache(const serialization_cache&) = delete;
+  serialization_cache(serialization_cache&&) = delete;
+  serialization_cache& operator=(const serialization_cache&) = delete;
+  serialization_cache& operator=(serialization_cache&&) = delete;
+  ~serialization_cache() = default;
+
+  template <typename Context, typename Statement>
+    requires(detail::has_parameters_only_v<Statement>)
+  auto to_sql_string(Context& context, const Statement& statement)
+      -> std::string {
+    const auto key =
+        key_t{typeid(Context), typeid(Statement), dynamic_shape(statement)};
+    {
+      const auto lock = std::lock_guard{_mutex};
+      if (const auto it = _entries.find(key); it != _entries.end()) {
+        restore_parameter_count(context, it->second.parameter_count);
+        return it->second.sql;
+      }
+    }
+
+    using ::sqlpp::to_sql_string;
+    auto entry = entry_t{to_sql_string(context, statement),
+                         parameter_count(context)};
+    const auto lock = std::lock_guard{_mutex};
+    // If another thread was faster, its (identical) entry is kept.
+    _entries.emplace(key, entry);
+    return std::move(entry.sql);
+  }
+
+  auto size() const -> size_t {
+    const auto lock = std::lock_guard{_mutex};
+    return _entries.size();
+  }
+
+  void clear() {
+    const auto lock = std::lock_guard{_mutex};
+    _entries.clear();
+  }
+
+ private:
+  struct key_t {
+    std::type_index context;
+    std::type_index statement;
+    uint64_t shape;
+
+    bool operator==(const key_t&) const = default;
+  };
+
+  struct key_hash {
+    size_t operator()(const key_t& key) const {
+      auto h = key.statement.hash_code();
+      h = h * 31 + key.context.hash_code();
+      return h * 31 + std::hash<uint64_t>{}(key.shape);
+    }
+  };
+
+  struct entry_t {
+    std::string sql;
+    size_t parameter_count;
+  };
+
+  // Some connectors (e.g. PostgreSQL) count parameters in the context while
+  // serializing.
+  template <typename Context>
+  static auto parameter_count(const Context& context) -> size_t {
+    if constexpr (requires { context._count; }) {
+      return context._count;
+    } else {
+      return 0;
+    }
+  }
+
+  template <typename Context>
+  static auto restore_parameter_count(Context& context, size_t count) -> void {
+    if constexpr (requires { context._count = count; }) {
+      context._count = count;
+    }
+  }
+
+  mutable std::mutex _mutex;
+  std::unordered_map<key_t, entry_t, key_hash> _entries;
+};
+
+namespace detail {
+// Serializes statements for connections, using a serialization_cache while
+// one is in effect, see connection::prepare(statement, cache).
+class prepared_sql_t {
+ public:
+  template <typename Context, typename Statement>
+  auto operator()(Context& context, const Statement& statement) const
+      -> std::string {
+    if constexpr (has_parameters_only_v<Statement>) {
+      if (_cache) {
+        return _cache->to_sql_string(context, statement);
+      }
+    }
+    using ::sqlpp::to_sql_string;
+    return to_sql_string(context, statement);
+  }
+
+  // Returns f(), serializing via `cache` in the meantime.
+  template <typename F>
+  auto with_cache(serialization_cache& cache, const F& f) {
+    struct reset_t {
+      serialization_cache*& cache;
+      ~reset_t() { cache = nullptr; }
+    } reset{_cache};
+    _cache = &cache;
+    return f();
+  }
+
+ private:
+  serialization_cache* _cache{nullptr};
+};
+}  // namespace detail
+}  // namespace sqlpp
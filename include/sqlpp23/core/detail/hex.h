@@ -0,0 +1,325 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define SQLPP_HEX_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SQLPP_HEX_SSE2 1
+#endif
+#if defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define SQLPP_HEX_NEON 1
+#endif
+
+// Hex encoding and decoding of blobs, e.g. for blob literals and for the
+// PostgreSQL text protocol, which transfers bytea values as hex strings.
+//
+// The vectorized implementation is selected at compile time (AVX2 if enabled
+// via compiler flags, SSE2 on x86-64, NEON on AArch64). The scalar
+// implementation handles the remaining bytes and all other platforms.
+namespace sqlpp::detail {
+inline constexpr char hex_chars[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
+                                       '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+
+inline constexpr uint8_t invalid_hex_char = 0xFF;
+
+inline constexpr auto unhex_table = [] {
+  std::array<uint8_t, 256> table{};
+  table.fill(invalid_hex_char);
+  for (uint8_t i = 0; i < 10; ++i) {
+    table['0' + i] = i;
+  }
+  for (uint8_t i = 0; i < 6; ++i) {
+    table['a' + i] = static_cast<uint8_t>(10 + i);
+    table['A' + i] = static_cast<uint8_t>(10 + i);
+  }
+  return table;
+}();
+
+// Writes `size * 2` upper case hex digits to `out`.
+inline void hex_encode_scalar(const uint8_t* in, size_t size, char* out) {
+  for (size_t i = 0; i < size; ++i) {
+    out[2 * i] = hex_chars[in[i] >> 4];
+    out[2 * i + 1] = hex_chars[in[i] & 0x0F];
+  }
+}
+
+// Decodes `size / 2` bytes from `size` hex digits (upper or lower case).
+// Returns the index of the first invalid input character, or `size` if the
+// input is valid.
+inline size_t hex_decode_scalar(const char* in, size_t size, uint8_t* out) {
+  for (size_t i = 0; i + 1 < size; i += 2) {
+    const auto high = unhex_table[static_cast<uint8_t>(in[i])];
+    const auto low = unhex_table[static_cast<uint8_t>(in[i + 1])];
+    if (high == invalid_hex_char) {
+      return i;
+    }
+    if (low == invalid_hex_char) {
+      return i + 1;
+    }
+    out[i / 2] = static_cast<uint8_t>((high << 4) | low);
+  }
+  return size;
+}
+
+#if defined(SQLPP_HEX_SSE2)
+namespace hex_sse2 {
+// Maps nibbles (0..15) to '0'..'9', 'A'..'F'
+inline __m128i nibbles_to_chars(__m128i nibbles) {
+  const auto above_9 = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+  return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')),
+                      _mm_and_si128(above_9, _mm_set1_epi8('A' - '0' - 10)));
+}
+
+// Encodes 16 bytes into 32 chars.
+inline void encode16(const uint8_t* in, char* out) {
+  const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in));
+  const auto mask = _mm_set1_epi8(0x0F);
+  const auto high = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+  const auto low = _mm_and_si128(bytes, mask);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out),
+                   nibbles_to_chars(_mm_unpacklo_epi8(high, low)));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16),
+                   nibbles_to_chars(_mm_unpackhi_epi8(high, low)));
+}
+
+// Maps hex chars to nibbles. Bytes of `invalid` are set to 0xFF for all
+// characters that are not hex digits.
+inline __m128i chars_to_nibbles(__m128i chars, __m128i& invalid) {
+  const auto digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+  const auto is_digit =
+      _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+  const auto letter = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)),
+                                   _mm_set1_epi8('a'));
+  const auto is_letter =
+      _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+  invalid = _mm_or_si128(
+      invalid, _mm_andnot_si128(_mm_or_si128(is_digit, is_letter),
+                                _mm_set1_epi8(static_cast<char>(0xFF))));
+  return _mm_or_si128(
+      _mm_and_si128(is_digit, digit),
+      _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+}
+
+// Combines pairs of nibbles (high nibble first) into bytes in the low half
+// of each 16 bit lane.
+inline __m128i combine_nibbles(__m128i nibbles) {
+  const auto high = _mm_and_si128(nibbles, _mm_set1_epi16(0x00FF));
+  const auto low = _mm_srli_epi16(nibbles, 8);
+  return _mm_or_si128(_mm_slli_epi16(high, 4), low);
+}
+
+// Decodes 32 chars into 16 bytes. Returns false if there are invalid chars.
+inline bool decode32(const char* in, uint8_t* out) {
+  auto invalid = _mm_setzero_si128();
+  const auto first = chars_to_nibbles(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(in)), invalid);
+  const auto second = chars_to_nibbles(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 16)), invalid);
+  if (_mm_movemask_epi8(invalid) != 0) {
+    return false;
+  }
+  _mm_storeu_si128(
+      reinterpret_cast<__m128i*>(out),
+      _mm_packus_epi16(combine_nibbles(first), combine_nibbles(second)));
+  return true;
+}
+}  // namespace hex_sse2
+#endif
+
+#if defined(SQLPP_HEX_AVX2)
+namespace hex_avx2 {
+inline __m256i nibbles_to_chars(__m256i nibbles) {
+  const auto above_9 = _mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9));
+  return _mm256_add_epi8(
+      _mm256_add_epi8(nibbles, _mm256_set1_epi8('0')),
+      _mm256_and_si256(above_9, _mm256_set1_epi8('A' - '0' - 10)));
+}
+
+// Encodes 32 bytes into 64 chars.
+inline void encode32(const uint8_t* in, char* out) {
+  const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in));
+  const auto mask = _mm256_set1_epi8(0x0F);
+  const auto high = _mm256_and_si256(_mm256_srli_epi16(bytes, 4), mask);
+  const auto low = _mm256_and_si256(bytes, mask);
+  // Unpacking works per 128 bit lane: bytes 0-7 and 16-23, resp. 8-15 and
+  // 24-31.
+  const auto a = nibbles_to_chars(_mm256_unpacklo_epi8(high, low));
+  const auto b = nibbles_to_chars(_mm256_unpackhi_epi8(high, low));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                      _mm256_permute2x128_si256(a, b, 0x20));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 32),
+                      _mm256_permute2x128_si256(a, b, 0x31));
+}
+
+inline __m256i chars_to_nibbles(__m256i chars, __m256i& invalid) {
+  const auto digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+  const auto is_digit =
+      _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+  const auto letter = _mm256_sub_epi8(
+      _mm256_or_si256(chars, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+  const auto is_letter =
+      _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+  invalid = _mm256_or_si256(
+      invalid, _mm256_andnot_si256(_mm256_or_si256(is_digit, is_letter),
+                                   _mm256_set1_epi8(static_cast<char>(0xFF))));
+  return _mm256_or_si256(
+      _mm256_and_si256(is_digit, digit),
+      _mm256_and_si256(is_letter,
+                       _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+}
+
+inline __m256i combine_nibbles(__m256i nibbles) {
+  const auto high = _mm256_and_si256(nibbles, _mm256_set1_epi16(0x00FF));
+  const auto low = _mm256_srli_epi16(nibbles, 8);
+  return _mm256_or_si256(_mm256_slli_epi16(high, 4), low);
+}
+
+// Decodes 64 chars into 32 bytes. Returns false if there are invalid chars.
+inline bool decode64(const char* in, uint8_t* out) {
+  auto invalid = _mm256_setzero_si256();
+  const auto first = chars_to_nibbles(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in)), invalid);
+  const auto second = chars_to_nibbles(
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 32)), invalid);
+  if (_mm256_movemask_epi8(invalid) != 0) {
+    return false;
+  }
+  // Packing works per 128 bit lane, too, restore the order of the 64 bit
+  // blocks.
+  const auto packed =
+      _mm256_packus_epi16(combine_nibbles(first), combine_nibbles(second));
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+                      _mm256_permute4x64_epi64(packed, 0xD8));
+  return true;
+}
+}  // namespace hex_avx2
+#endif
+
+#if defined(SQLPP_HEX_NEON)
+namespace hex_neon {
+inline uint8x16_t nibbles_to_chars(uint8x16_t nibbles) {
+  const auto table =
+      vld1q_u8(reinterpret_cast<const uint8_t*>(hex_chars));
+  return vqtbl1q_u8(table, nibbles);
+}
+
+// Encodes 16 bytes into 32 chars.
+inline void encode16(const uint8_t* in, char* out) {
+  const auto bytes = vld1q_u8(in);
+  uint8x16x2_t chars;
+  chars.val[0] = nibbles_to_chars(vshrq_n_u8(bytes, 4));
+  chars.val[1] = nibbles_to_chars(vandq_u8(bytes, vdupq_n_u8(0x0F)));
+  vst2q_u8(reinterpret_cast<uint8_t*>(out), chars);
+}
+
+inline uint8x16_t chars_to_nibbles(uint8x16_t chars, uint8x16_t& invalid) {
+  const auto digit = vsubq_u8(chars, vdupq_n_u8('0'));
+  const auto is_digit = vcleq_u8(digit, vdupq_n_u8(9));
+  const auto letter =
+      vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+  const auto is_letter = vcleq_u8(letter, vdupq_n_u8(5));
+  invalid = vorrq_u8(invalid, vmvnq_u8(vorrq_u8(is_digit, is_letter)));
+  return vbslq_u8(is_digit, digit, vaddq_u8(letter, vdupq_n_u8(10)));
+}
+
+// Decodes 32 chars into 16 bytes. Returns false if there are invalid chars.
+inline bool decode32(const char* in, uint8_t* out) {
+  // De-interleaves high and low nibble chars.
+  const auto chars = vld2q_u8(reinterpret_cast<const uint8_t*>(in));
+  auto invalid = vdupq_n_u8(0);
+  const auto high = chars_to_nibbles(chars.val[0], invalid);
+  const auto low = chars_to_nibbles(chars.val[1], invalid);
+  if (vmaxvq_u8(invalid) != 0) {
+    return false;
+  }
+  vst1q_u8(out, vorrq_u8(vshlq_n_u8(high, 4), low));
+  return true;
+}
+}  // namespace hex_neon
+#endif
+
+// Writes `size * 2` upper case hex digits to `out`.
+inline void hex_encode(const uint8_t* in, size_t size, char* out) {
+  size_t i = 0;
+#if defined(SQLPP_HEX_AVX2)
+  for (; i + 32 <= size; i += 32) {
+    hex_avx2::encode32(in + i, out + 2 * i);
+  }
+#endif
+#if defined(SQLPP_HEX_SSE2)
+  for (; i + 16 <= size; i += 16) {
+    hex_sse2::encode16(in + i, out + 2 * i);
+  }
+#elif defined(SQLPP_HEX_NEON)
+  for (; i + 16 <= size; i += 16) {
+    hex_neon::encode16(in + i, out + 2 * i);
+  }
+#endif
+  hex_encode_scalar(in + i, size - i, out + 2 * i);
+}
+
+// Decodes `size / 2` bytes from `size` hex digits (upper or lower case).
+// `size` is expected to be even.
+// Returns the index of the first invalid input character, or `size` if the
+// input is valid.
+inline size_t hex_decode(const char* in, size_t size, uint8_t* out) {
+  size_t i = 0;
+#if defined(SQLPP_HEX_AVX2)
+  for (; i + 64 <= size; i += 64) {
+    if (not hex_avx2::decode64(in + i, out + i / 2)) {
+      break;
+    }
+  }
+#endif
+#if defined(SQLPP_HEX_SSE2)
+  for (; i + 32 <= size; i += 32) {
+    if (not hex_sse2::decode32(in + i, out + i / 2)) {
+      break;
+    }
+  }
+#elif defined(SQLPP_HEX_NEON)
+  for (; i + 32 <= size; i += 32) {
+    if (not hex_neon::decode32(in + i, out + i / 2)) {
+      break;
+    }
+  }
+#endif
+  // The scalar implementation takes care of the tail and pinpoints invalid
+  // characters.
+  return i + hex_decode_scalar(in + i, size - i, out + i / 2);
+}
+}  // namespace sqlpp::detail
@@ -27,62 +27,81 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
-#include <sqlpp23/core/chrono.h>
+#include <string_view>
 
-#include <cctype>
+#include <sqlpp23/core/chrono.h>
 
+// The parsers below are length-aware: They consume a prefix of the given
+// std::string_view and do not require null-terminated input. Result fields
+// of the connectors come with a known length, so there is no need to scan
+// for the terminator (or to rely on it being there).
+//
+// Overloads for null-terminated `const char*&` input are provided for
+// convenience.
 namespace sqlpp::detail {
-inline bool parse_unsigned(int& value, const char*& input, int length) {
-  value = 0;
-  auto new_input = input;
-  while (length--) {
-    auto ch = *new_input++;
-    if (std::isdigit(ch) == false) {
-      return false;
-    }
-    value = value * 10 + ch - '0';
+// Parses exactly `length` decimal digits. Digits are accumulated without
+// branching per character; invalid characters are collected and checked
+// once at the end.
+template <int length>
+inline bool parse_fixed_digits(int& value, std::string_view& input) {
+  if (input.size() < static_cast<size_t>(length)) {
+    return false;
   }
-  input = new_input;
+  unsigned invalid = 0;
+  int result = 0;
+  for (int i = 0; i < length; ++i) {
+    const auto digit = static_cast<unsigned>(
+        static_cast<unsigned char>(input[static_cast<size_t>(i)]) - '0');
+    invalid |= static_cast<unsigned>(digit > 9);
+    result = result * 10 + static_cast<int>(digit);
+  }
+  if (invalid) {
+    return false;
+  }
+  value = result;
+  input.remove_prefix(static_cast<size_t>(length));
   return true;
 }
 
-inline bool parse_character(const char*& input, char ch) {
-  if (*input != ch) {
+inline bool parse_character(std::string_view& input, char ch) {
+  if (input.empty() or input.front() != ch) {
     return false;
   }
-  ++input;
+  input.remove_prefix(1);
   return true;
 }
 
-inline bool parse_yyyy_mm_dd(std::chrono::sys_days& dp, const char*& input) {
+inline bool parse_yyyy_mm_dd(std::chrono::sys_days& dp,
+                             std::string_view& input) {
   auto new_input = input;
   int year, month, day;
-  if ((parse_unsigned(year, new_input, 4) == false) ||
+  if ((parse_fixed_digits<4>(year, new_input) == false) ||
       (parse_character(new_input, '-') == false) ||
-      (parse_unsigned(month, new_input, 2) == false) ||
+      (parse_fixed_digits<2>(month, new_input) == false) ||
       (parse_character(new_input, '-') == false) ||
-      (parse_unsigned(day, new_input, 2) == false)) {
+      (parse_fixed_digits<2>(day, new_input) == false)) {
     return false;
   }
+  // Strings that have valid format but year, month and/or day values that fall
+  // outside of the correct ranges are still mapped to date values. For the
+  // exact rules of the mapping see
+  // https://en.cppreference.com/w/cpp/chrono/year_month_day/operator_days
   dp = std::chrono::year{year} / month / day;
   input = new_input;
   return true;
 }
 
-inline bool parse_hh_mm_ss(std::chrono::microseconds& us, const char*& input) {
+inline bool parse_hh_mm_ss(std::chrono::microseconds& us,
+                           std::string_view& input) {
   auto new_input = input;
   int hour, minute, second;
-  if ((parse_unsigned(hour, new_input, 2) == false) ||
+  if ((parse_fixed_digits<2>(hour, new_input) == false) ||
       (parse_character(new_input, ':') == false) ||
-      (parse_unsigned(minute, new_input, 2) == false) ||
+      (parse_fixed_digits<2>(minute, new_input) == false) ||
       (parse_character(new_input, ':') == false) ||
-      (parse_unsigned(second, new_input, 2) == false)) {
+      (parse_fixed_digits<2>(second, new_input) == false)) {
     return false;
   }
-  // Strings that have valid format but year, month and/or day values that fall
-  // outside of the correct ranges are still mapped to date values. For the
-  // exact rules of the mapping see
-  // https://en.cppreference.com/w/cpp/chrono/year_month_day/operator_days
   us = std::chrono::hours{hour} + std::chrono::minutes{minute} +
        std::chrono::seconds{second};
   input = new_input;
@@ -90,30 +109,33 @@ inline bool parse_hh_mm_ss(std::chrono::microseconds& us, const char*& input) {
 }
 
 inline bool parse_ss_fraction(std::chrono::microseconds& us,
-                              const char*& input) {
+                              std::string_view& input) {
   auto new_input = input;
   if (parse_character(new_input, '.') == false) {
     return false;
   }
+  constexpr size_t len_max = 6;
+  constexpr int scale[len_max + 1] = {1, 100000, 10000, 1000, 100, 10, 1};
   int value = 0;
-  int len_max = 6;
-  int len_actual;
-  for (len_actual = 0; (len_actual < len_max) && std::isdigit(*new_input);
-       ++len_actual, ++new_input) {
-    value = value * 10 + *new_input - '0';
+  size_t len_actual = 0;
+  for (; len_actual < len_max and len_actual < new_input.size() and
+         static_cast<unsigned>(static_cast<unsigned char>(
+                                   new_input[len_actual]) -
+                               '0') <= 9;
+       ++len_actual) {
+    value = value * 10 + (new_input[len_actual] - '0');
   }
   if (len_actual == 0) {
     return false;
   }
-  for (; len_actual < len_max; ++len_actual) {
-    value *= 10;
-  }
-  us = std::chrono::microseconds{value};
+  new_input.remove_prefix(len_actual);
+  us = std::chrono::microseconds{value * scale[len_actual]};
   input = new_input;
   return true;
 }
 
-inline bool parse_tz(std::chrono::microseconds& offset, const char*& input) {
+inline bool parse_tz(std::chrono::microseconds& offset,
+                     std::string_view& input) {
   auto new_input = input;
   int tz_sign;
   if (parse_character(new_input, '+')) {
@@ -124,21 +146,21 @@ inline bool parse_tz(std::chrono::microseconds& offset, const char*& input) {
     return false;
   }
   int hour;
-  if (parse_unsigned(hour, new_input, 2) == false) {
+  if (parse_fixed_digits<2>(hour, new_input) == false) {
     return false;
   }
   offset = tz_sign * std::chrono::hours{hour};
   input = new_input;
   int minute;
   if ((parse_character(new_input, ':') == false) ||
-      (parse_unsigned(minute, new_input, 2) == false)) {
+      (parse_fixed_digits<2>(minute, new_input) == false)) {
     return true;
   }
   offset += tz_sign * std::chrono::minutes{minute};
   input = new_input;
   int second;
   if ((parse_character(new_input, ':') == false) ||
-      (parse_unsigned(second, new_input, 2) == false)) {
+      (parse_fixed_digits<2>(second, new_input) == false)) {
     return true;
   }
   offset += tz_sign * std::chrono::seconds{second};
@@ -147,7 +169,7 @@ inline bool parse_tz(std::chrono::microseconds& offset, const char*& input) {
 }
 
 inline bool parse_hh_mm_ss_us_tz(std::chrono::microseconds& us,
-                                 const char*& input) {
+                                 std::string_view& input) {
   if (parse_hh_mm_ss(us, input) == false) {
     return false;
   }
@@ -165,9 +187,9 @@ inline bool parse_hh_mm_ss_us_tz(std::chrono::microseconds& us,
 // Parse timestamp formatted as YYYY-MM-DD HH:MM:SS.U+HH:MM:SS
 // The microseconds and timezone offset are optional
 //
-// date_time_string will point to non-consumed characters
+// date_time_string will be left with the non-consumed characters
 inline bool parse_timestamp(::sqlpp::chrono::sys_microseconds& tp,
-                            const char*& date_time_string) {
+                            std::string_view& date_time_string) {
   std::chrono::sys_days parsed_ymd;
   std::chrono::microseconds parsed_tod;
   if ((parse_yyyy_mm_dd(parsed_ymd, date_time_string) == false) ||
@@ -181,17 +203,42 @@ inline bool parse_timestamp(::sqlpp::chrono::sys_microseconds& tp,
 
 // Parse date string formatted as YYYY-MM-DD
 //
-// date_string will point to non-consumed characters
-inline bool parse_date(std::chrono::sys_days& dp, const char*& date_string) {
+// date_string will be left with the non-consumed characters
+inline bool parse_date(std::chrono::sys_days& dp,
+                       std::string_view& date_string) {
   return parse_yyyy_mm_dd(dp, date_string);
 }
 
 // Parse time of day string formatted as HH:MM:SS.U+HH:MM:SS
 // The microseconds and timezone offset are optional
 //
-// time_string will point to non-consumed characters
+// time_string will be left with the non-consumed characters
 inline bool parse_time(std::chrono::microseconds& us,
-                              const char*& time_string) {
+                       std::string_view& time_string) {
   return parse_hh_mm_ss_us_tz(us, time_string);
 }
+
+// Null-terminated input. The pointer will point to non-consumed characters.
+inline bool parse_timestamp(::sqlpp::chrono::sys_microseconds& tp,
+                            const char*& date_time_string) {
+  std::string_view input{date_time_string};
+  const auto result = parse_timestamp(tp, input);
+  date_time_string = input.data();
+  return result;
+}
+
+inline bool parse_date(std::chrono::sys_days& dp, const char*& date_string) {
+  std::string_view input{date_string};
+  const auto result = parse_date(dp, input);
+  date_string = input.data();
+  return result;
+}
+
+inline bool parse_time(std::chrono::microseconds& us,
+                       const char*& time_string) {
+  std::string_view input{time_string};
+  const auto result = parse_time(us, input);
+  time_string = input.data();
+  return result;
+}
 }  // namespace sqlpp::detail
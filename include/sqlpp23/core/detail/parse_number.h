@@ -0,0 +1,54 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <charconv>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace sqlpp::detail {
+// Parses a number from a text protocol result field of known length.
+//
+// In contrast to strtoll/strtod/atof, std::from_chars is locale-independent,
+// does not skip whitespace, and does not require null-terminated input.
+//
+// If the input does not start with a number, `value` is set to zero (which
+// is what strtoll & friends do, too). Returns true if the whole input was
+// consumed.
+template <typename T>
+  requires(std::is_arithmetic_v<T>)
+bool parse_number(T& value, std::string_view input) {
+  const auto* end = input.data() + input.size();
+  const auto [ptr, ec] = std::from_chars(input.data(), end, value);
+  if (ec != std::errc{}) {
+    value = T{};
+    return false;
+  }
+  return ptr == end;
+}
+}  // namespace sqlpp::detail
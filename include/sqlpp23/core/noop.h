@@ -47,12 +47,12 @@ struct no_result_methods_t {
   }
 
   // Prepare
-  template <typename Statement, typename Db>
-  auto _prepare(this Statement&& self, Db& db)
+  template <typename Statement, typename Db, typename... Options>
+  auto _prepare(this Statement&& self, Db& db, Options... options)
       -> prepared_execute_t<Db, std::decay_t<Statement>> {
     return prepared_execute_t<Db, std::decay_t<Statement>>{
         statement_handler_t{}.prepare_execute(std::forward<Statement>(self),
-                                              db)};
+                                              db, options...)};
   }
 };
 
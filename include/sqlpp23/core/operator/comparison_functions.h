@@ -39,6 +39,12 @@ struct comparison_expression;
 template <typename L, typename Operator, typename Container>
 struct in_expression;
 
+template <typename DataType, typename NameTag>
+struct parameter_t;
+
+template <typename DataType, typename NameTag, size_t Capacity>
+struct array_parameter_t;
+
 template <typename L, typename Strategy>
 struct sort_order_expression;
 
@@ -124,13 +130,22 @@ constexpr auto in(L lhs, Args... args)
   return {std::move(lhs), std::make_tuple(std::move(args)...)};
 }
 
-template <typename L, typename Arg>
+template <typename L, typename Arg, typename Allocator>
   requires(values_are_comparable<L, Arg>::value)
-constexpr auto in(L lhs, std::vector<Arg> args)
-    -> in_expression<L, operator_in, std::vector<Arg>> {
+constexpr auto in(L lhs, std::vector<Arg, Allocator> args)
+    -> in_expression<L, operator_in, std::vector<Arg, Allocator>> {
   return {std::move(lhs), std::move(args)};
 }
 
+template <typename L, typename DataType, typename NameTag, size_t Capacity>
+  requires(values_are_comparable<L, parameter_t<DataType, NameTag>>::value)
+constexpr auto in(L lhs, array_parameter_t<DataType, NameTag, Capacity> arg)
+    -> in_expression<L,
+                     operator_in,
+                     array_parameter_t<DataType, NameTag, Capacity>> {
+  return {std::move(lhs), std::move(arg)};
+}
+
 template <typename L, typename... Args>
   requires((sizeof...(Args) != 0) and
            logic::all<values_are_comparable<L, Args>::value...>::value)
@@ -147,13 +162,22 @@ constexpr auto not_in(L lhs, Args... args)
   return {std::move(lhs), std::make_tuple(std::move(args)...)};
 }
 
-template <typename L, typename Arg>
+template <typename L, typename Arg, typename Allocator>
   requires(values_are_comparable<L, Arg>::value)
-constexpr auto not_in(L lhs, std::vector<Arg> args)
-    -> in_expression<L, operator_not_in, std::vector<Arg>> {
+constexpr auto not_in(L lhs, std::vector<Arg, Allocator> args)
+    -> in_expression<L, operator_not_in, std::vector<Arg, Allocator>> {
   return {std::move(lhs), std::move(args)};
 }
 
+template <typename L, typename DataType, typename NameTag, size_t Capacity>
+  requires(values_are_comparable<L, parameter_t<DataType, NameTag>>::value)
+constexpr auto not_in(L lhs, array_parameter_t<DataType, NameTag, Capacity> arg)
+    -> in_expression<L,
+                     operator_not_in,
+                     array_parameter_t<DataType, NameTag, Capacity>> {
+  return {std::move(lhs), std::move(arg)};
+}
+
 template <typename L, typename R1, typename R2>
   requires(values_are_comparable<L, R1>::value and
            values_are_comparable<L, R2>::value)
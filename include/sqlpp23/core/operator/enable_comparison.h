@@ -46,8 +46,8 @@ class enable_comparison {
     return ::sqlpp::in(std::forward<Expr>(self), std::move(args)...);
   }
 
-  template <typename Expr, typename Arg>
-  constexpr auto in(this Expr&& self, std::vector<Arg> args)
+  template <typename Expr, typename Arg, typename Allocator>
+  constexpr auto in(this Expr&& self, std::vector<Arg, Allocator> args)
       -> decltype(::sqlpp::in(std::forward<Expr>(self), std::move(args))) {
     return ::sqlpp::in(std::forward<Expr>(self), std::move(args));
   }
@@ -65,8 +65,8 @@ class enable_comparison {
     return ::sqlpp::not_in(std::forward<Expr>(self), std::move(args)...);
   }
 
-  template <typename Expr, typename Arg>
-  constexpr auto not_in(this Expr&& self, std::vector<Arg> args)
+  template <typename Expr, typename Arg, typename Allocator>
+  constexpr auto not_in(this Expr&& self, std::vector<Arg, Allocator> args)
       -> decltype(::sqlpp::not_in(std::forward<Expr>(self), std::move(args))) {
     return ::sqlpp::not_in(std::forward<Expr>(self), std::move(args));
   }
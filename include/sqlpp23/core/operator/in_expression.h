@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <tuple>
 #include <vector>
 
+#include <sqlpp23/core/basic/array_parameter.h>
 #include <sqlpp23/core/logic.h>
 #include <sqlpp23/core/operator/enable_as.h>
 #include <sqlpp23/core/operator/enable_comparison.h>
@@ -70,8 +71,8 @@ struct in_expression<L, Operator, std::tuple<Args...>>
   std::tuple<Args...> _rhs;
 };
 
-template <typename L, typename Operator, typename R>
-struct data_type_of<in_expression<L, Operator, std::vector<R>>>
+template <typename L, typename Operator, typename R, typename Allocator>
+struct data_type_of<in_expression<L, Operator, std::vector<R, Allocator>>>
     : std::conditional<sqlpp::is_optional<data_type_of_t<L>>::value or
                            sqlpp::is_optional<data_type_of_t<R>>::value,
                        std::optional<boolean>,
@@ -85,13 +86,52 @@ struct data_type_of<in_expression<L, Operator, std::tuple<Args...>>>
                        std::optional<boolean>,
                        boolean> {};
 
-template <typename L, typename Operator, typename R>
-struct nodes_of<in_expression<L, Operator, std::vector<R>>> {
+template <typename L, typename Operator, typename R, typename Allocator>
+struct nodes_of<in_expression<L, Operator, std::vector<R, Allocator>>> {
   using type = detail::type_vector<L, R>;
 };
 
-template <typename L, typename Operator, typename R>
-struct requires_parentheses<in_expression<L, Operator, std::vector<R>>>
+// The number of elements is only known at runtime.
+template <typename L, typename Operator, typename R, typename Allocator>
+struct holds_sql_values<in_expression<L, Operator, std::vector<R, Allocator>>>
+    : public std::true_type {};
+
+template <typename L, typename Operator, typename R, typename Allocator>
+struct requires_parentheses<
+    in_expression<L, Operator, std::vector<R, Allocator>>>
+    : public std::true_type {};
+
+template <typename L,
+          typename Operator,
+          typename DataType,
+          typename NameTag,
+          size_t Capacity>
+struct data_type_of<in_expression<L,
+                                  Operator,
+                                  array_parameter_t<DataType, NameTag, Capacity>>>
+    : std::conditional<sqlpp::is_optional<data_type_of_t<L>>::value,
+                       std::optional<boolean>,
+                       boolean> {};
+
+template <typename L,
+          typename Operator,
+          typename DataType,
+          typename NameTag,
+          size_t Capacity>
+struct nodes_of<in_expression<L,
+                              Operator,
+                              array_parameter_t<DataType, NameTag, Capacity>>> {
+  using type =
+      detail::type_vector<L, array_parameter_t<DataType, NameTag, Capacity>>;
+};
+
+template <typename L,
+          typename Operator,
+          typename DataType,
+          typename NameTag,
+          size_t Capacity>
+struct requires_parentheses<
+    in_expression<L, Operator, array_parameter_t<DataType, NameTag, Capacity>>>
     : public std::true_type {};
 
 template <typename L, typename Operator, typename... Args>
@@ -120,9 +160,14 @@ auto to_sql_string(Context& context,
 template <typename Container>
 struct value_list_t;
 
-template <typename Context, typename L, typename Operator, typename R>
-auto to_sql_string(Context& context,
-                   const in_expression<L, Operator, std::vector<R>>& t)
+template <typename Context,
+          typename L,
+          typename Operator,
+          typename R,
+          typename Allocator>
+auto to_sql_string(
+    Context& context,
+    const in_expression<L, Operator, std::vector<R, Allocator>>& t)
     -> std::string {
   auto result = to_sql_string(context, read.lhs(t)) + Operator::symbol + " (";
   bool first = true;
@@ -144,4 +189,20 @@ auto to_sql_string(Context& context,
   return result;
 }
 
+template <typename Context,
+          typename L,
+          typename Operator,
+          typename DataType,
+          typename NameTag,
+          size_t Capacity>
+auto to_sql_string(
+    Context& context,
+    const in_expression<L,
+                        Operator,
+                        array_parameter_t<DataType, NameTag, Capacity>>& t)
+    -> std::string {
+  return operand_to_sql_string(context, read.lhs(t)) + Operator::symbol +
+         " (" + to_sql_string(context, read.rhs(t)) + ")";
+}
+
 }  // namespace sqlpp
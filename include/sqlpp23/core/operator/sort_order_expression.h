@@ -81,6 +81,10 @@ struct nodes_of<sort_order_expression<L, Strategy>> {
   using type = detail::type_vector<L>;
 };
 
+template <typename L, typename Strategy>
+struct holds_sql_values<sort_order_expression<L, Strategy>>
+    : public std::true_type {};
+
 template <typename L, typename Strategy>
 struct is_sort_order<sort_order_expression<L, Strategy>> : std::true_type {};
 
@@ -27,10 +27,15 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <vector>
 
+#include <sqlpp23/core/database/exception.h>
 #include <sqlpp23/core/wrong.h>
 
 namespace sqlpp {
@@ -57,5 +62,54 @@ auto bind_parameter(Statement& statement, size_t parameter_index, const std::opt
     statement.bind_null(parameter_index);
 }
 
+// The value of an array_parameter_t, see array_parameter.h
+template <typename Value, size_t Capacity>
+struct array_parameter_value : public std::vector<Value> {
+  static constexpr size_t capacity = Capacity;
+
+  using std::vector<Value>::vector;
+  array_parameter_value() = default;
+  array_parameter_value(std::vector<Value> values)
+      : std::vector<Value>(std::move(values)) {}
+};
+
+// Number of placeholders a parameter value occupies in the prepared
+// statement. Connectors with native array parameters specialize this for
+// array_parameter_value.
+template <typename Statement, typename Value>
+struct placeholder_count : public std::integral_constant<size_t, 1> {};
+
+template <typename Statement, typename Value, size_t Capacity>
+struct placeholder_count<Statement, array_parameter_value<Value, Capacity>>
+    : public std::integral_constant<size_t, Capacity> {};
+
+template <typename Value, size_t Capacity>
+auto check_array_parameter_size(
+    const array_parameter_value<Value, Capacity>& parameter) -> void {
+  if (parameter.empty()) {
+    throw sqlpp::exception{"array parameter must not be empty"};
+  }
+  if (parameter.size() > Capacity) {
+    throw sqlpp::exception{"array parameter holds " +
+                           std::to_string(parameter.size()) +
+                           " values, but its capacity is " +
+                           std::to_string(Capacity)};
+  }
+}
+
+// Binds one placeholder per value. Unused placeholders repeat the last value,
+// which keeps both IN and NOT IN semantics intact (unlike NULL).
+template <typename Statement, typename Value, size_t Capacity>
+auto bind_parameter(Statement& statement,
+                    size_t parameter_index,
+                    const array_parameter_value<Value, Capacity>& parameter)
+    -> void {
+  check_array_parameter_size(parameter);
+  for (size_t i = 0; i < Capacity; ++i) {
+    bind_parameter(statement, parameter_index + i,
+                   parameter[std::min(i, parameter.size() - 1)]);
+  }
+}
+
 }  // namespace sqlpp
 
@@ -0,0 +1,551 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/basic/parameter.h>
+#include <sqlpp23/core/basic/value.h>
+#include <sqlpp23/core/detail/type_vector.h>
+#include <sqlpp23/core/operator/sort_order_expression.h>
+#include <sqlpp23/core/query/result_row.h>
+#include <sqlpp23/core/reader.h>
+#include <sqlpp23/core/to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp {
+namespace detail {
+template <typename SortOrder>
+struct keyset_column;
+
+template <typename L, typename Strategy>
+struct keyset_column<sort_order_expression<L, Strategy>> {
+  using type = L;
+};
+
+template <typename SortOrder>
+using keyset_column_t = typename keyset_column<SortOrder>::type;
+
+// Every placeholder needs its own parameter type. Keys other than the last
+// one appear twice in the condition, see keyset_condition().
+template <typename Column, size_t Occurrence>
+struct keyset_parameter_tag {
+  static constexpr bool require_quotes = false;
+  static constexpr const char name[] = "keyset";
+  template <typename T>
+  struct _member_t {
+    T _keyset_value = {};
+    T& operator()() { return _keyset_value; }
+    const T& operator()() const { return _keyset_value; }
+  };
+};
+
+template <typename Column, bool IsLast>
+struct keyset_parameters_t {
+  using _at_or_after_t =
+      parameter_t<data_type_of_t<Column>, keyset_parameter_tag<Column, 0>>;
+  using _after_t =
+      parameter_t<data_type_of_t<Column>, keyset_parameter_tag<Column, 1>>;
+};
+
+template <typename Value>
+bool keyset_value_is_null(const Value& value) {
+  if constexpr (is_optional<Value>::value) {
+    return not value.has_value();
+  } else {
+    return false;
+  }
+}
+
+template <typename Column, bool IsLast>
+bool keyset_value_is_null(const keyset_parameters_t<Column, IsLast>&) {
+  return false;
+}
+
+template <typename Context, typename Value>
+auto keyset_value_to_sql_string(Context& context,
+                                const Value& value,
+                                bool /*at_or_after*/) -> std::string {
+  if constexpr (is_optional<Value>::value) {
+    return to_sql_string(context, *value);
+  } else {
+    return to_sql_string(context, value);
+  }
+}
+
+template <typename Context, typename Column, bool IsLast>
+auto keyset_value_to_sql_string(Context& context,
+                                const keyset_parameters_t<Column, IsLast>&,
+                                bool at_or_after) -> std::string {
+  using _parameters_t = keyset_parameters_t<Column, IsLast>;
+  if (at_or_after) {
+    return to_sql_string(context, typename _parameters_t::_at_or_after_t{});
+  }
+  return to_sql_string(context, typename _parameters_t::_after_t{});
+}
+
+template <typename NameTag, typename... FieldSpecs>
+struct field_spec_by_name_tag {
+  using type = void;
+};
+
+template <typename NameTag, typename FieldSpec, typename... FieldSpecs>
+struct field_spec_by_name_tag<NameTag, FieldSpec, FieldSpecs...>
+    : public std::conditional_t<
+          std::is_same_v<name_tag_of_t<FieldSpec>, NameTag>,
+          std::type_identity<FieldSpec>,
+          field_spec_by_name_tag<NameTag, FieldSpecs...>> {};
+
+template <typename NameTag, typename... FieldSpecs>
+const auto& field_by_name_tag(const result_row_t<FieldSpecs...>& row) {
+  using _field_spec_t =
+      typename field_spec_by_name_tag<NameTag, FieldSpecs...>::type;
+  static_assert(not std::is_void_v<_field_spec_t>,
+                "keyset_pages requires all keys to be selected");
+  return static_cast<const member_t<
+      _field_spec_t, typename _field_spec_t::result_data_type>&>(row)();
+}
+
+// Either a condition or one of the constants TRUE and FALSE, so that
+// conditions on NULL values can be simplified.
+struct keyset_term_t {
+  enum class kind { condition, always, never };
+
+  kind _kind;
+  std::string _sql;
+  bool _has_parentheses = false;
+};
+
+inline auto keyset_and(keyset_term_t l, keyset_term_t r) -> keyset_term_t {
+  using kind = keyset_term_t::kind;
+  if (l._kind == kind::never or r._kind == kind::always) {
+    return l;
+  }
+  if (r._kind == kind::never or l._kind == kind::always) {
+    return r;
+  }
+  return {kind::condition, "(" + l._sql + " AND " + r._sql + ")", true};
+}
+
+inline auto keyset_or(keyset_term_t l, keyset_term_t r) -> keyset_term_t {
+  using kind = keyset_term_t::kind;
+  if (l._kind == kind::always or r._kind == kind::never) {
+    return l;
+  }
+  if (r._kind == kind::always or l._kind == kind::never) {
+    return r;
+  }
+  return {kind::condition, "(" + l._sql + " OR " + r._sql + ")", true};
+}
+
+struct keyset_key_terms_t {
+  keyset_term_t at_or_after;
+  keyset_term_t after;
+};
+
+// The null position is ignored unless keyset_has_null_position().
+template <typename L>
+auto keyset_sort_order(const sort_order_expression<L, sort_type>& s)
+    -> sort_order_null {
+  return {read.rhs(s), null_position::first};
+}
+
+template <typename L>
+auto keyset_sort_order(const sort_order_expression<L, sort_order_null>& s)
+    -> sort_order_null {
+  return read.rhs(s);
+}
+
+template <typename L>
+constexpr bool keyset_has_null_position(
+    const sort_order_expression<L, sort_order_null>&) {
+  return true;
+}
+
+template <typename L>
+constexpr bool keyset_has_null_position(
+    const sort_order_expression<L, sort_type>&) {
+  return false;
+}
+
+// The conditions for "at or after the value" and "after the value" in the
+// given sort order, including NULL handling.
+template <typename Context, typename SortOrder, typename Value>
+auto keyset_key_terms(Context& context,
+                      const SortOrder& sort_order,
+                      const Value& value,
+                      bool is_last) -> keyset_key_terms_t {
+  using kind = keyset_term_t::kind;
+  using _column_t = keyset_column_t<SortOrder>;
+
+  const auto order = keyset_sort_order(sort_order);
+  const bool ascending = order.order == sort_type::asc;
+  const bool nulls_last =
+      keyset_has_null_position(sort_order)
+          ? order.null_pos == null_position::last
+          : nulls_sort_first<Context>::value != ascending;
+
+  const auto column = operand_to_sql_string(context, read.lhs(sort_order));
+  if (keyset_value_is_null(value)) {
+    if (nulls_last) {
+      return {{kind::condition, column + " IS NULL"}, {kind::never, ""}};
+    }
+    return {{kind::always, ""}, {kind::condition, column + " IS NOT NULL"}};
+  }
+
+  // Serialize in placeholder order: at_or_after, then after.
+  auto at_or_after = keyset_term_t{kind::always, ""};
+  if (not is_last) {
+    at_or_after = {kind::condition,
+                   column + (ascending ? " >= " : " <= ") +
+                       keyset_value_to_sql_string(context, value, true)};
+  }
+  auto after = keyset_term_t{kind::condition,
+                             column + (ascending ? " > " : " < ") +
+                                 keyset_value_to_sql_string(context, value,
+                                                            false)};
+  if (can_be_null<_column_t>::value and nulls_last) {
+    const auto is_null = keyset_term_t{kind::condition, column + " IS NULL"};
+    if (not is_last) {
+      at_or_after = keyset_or(std::move(at_or_after), is_null);
+    }
+    after = keyset_or(std::move(after), is_null);
+  }
+  return {std::move(at_or_after), std::move(after)};
+}
+}  // namespace detail
+
+// Condition for the rows that come after `Values` in the order of
+// `SortOrders`, see keyset_t::after().
+template <typename SortOrders, typename Values>
+struct keyset_after_t;
+
+template <typename... SortOrders, typename... Values>
+struct keyset_after_t<std::tuple<SortOrders...>, std::tuple<Values...>> {
+  keyset_after_t(std::tuple<SortOrders...> sort_orders,
+                 std::tuple<Values...> values)
+      : _lhs(std::move(sort_orders)), _rhs(std::move(values)) {}
+  keyset_after_t(const keyset_after_t&) = default;
+  keyset_after_t(keyset_after_t&&) = default;
+  keyset_after_t& operator=(const keyset_after_t&) = default;
+  keyset_after_t& operator=(keyset_after_t&&) = default;
+  ~keyset_after_t() = default;
+
+ private:
+  friend reader_t;
+  std::tuple<SortOrders...> _lhs;
+  std::tuple<Values...> _rhs;
+};
+
+template <typename SortOrders, typename Values>
+struct data_type_of<keyset_after_t<SortOrders, Values>> {
+  using type = boolean;
+};
+
+template <typename... SortOrders, typename... Values>
+struct nodes_of<
+    keyset_after_t<std::tuple<SortOrders...>, std::tuple<Values...>>> {
+  using type = detail::type_vector<SortOrders..., Values...>;
+};
+
+template <typename Column, bool IsLast>
+struct parameters_of<detail::keyset_parameters_t<Column, IsLast>> {
+  using _parameters_t = detail::keyset_parameters_t<Column, IsLast>;
+  using type = std::conditional_t<
+      IsLast,
+      detail::type_vector<typename _parameters_t::_after_t>,
+      detail::type_vector<typename _parameters_t::_at_or_after_t,
+                          typename _parameters_t::_after_t>>;
+};
+
+// Serializes
+//   (k0 >= v0 AND (k0 > v0 OR (k1 >= v1 AND (k1 > v1 OR ... kn > vn))))
+// with < and <= for descending keys. In contrast to the equivalent
+//   k0 > v0 OR (k0 = v0 AND k1 > v1) OR ...
+// the leading condition lets the database use an index on k0 for a range
+// scan.
+template <typename Context, typename... SortOrders, typename... Values>
+auto to_sql_string(
+    Context& context,
+    const keyset_after_t<std::tuple<SortOrders...>, std::tuple<Values...>>& t)
+    -> std::string {
+  constexpr size_t _size = sizeof...(SortOrders);
+  auto terms = std::vector<detail::keyset_key_terms_t>{};
+  terms.reserve(_size);
+  [&]<size_t... Is>(std::index_sequence<Is...>) {
+    (terms.push_back(detail::keyset_key_terms(
+         context, std::get<Is>(read.lhs(t)), std::get<Is>(read.rhs(t)),
+         Is + 1 == _size)),
+     ...);
+  }(std::index_sequence_for<SortOrders...>{});
+
+  auto condition = std::move(terms.back().after);
+  for (size_t i = _size - 1; i-- > 0;) {
+    condition = detail::keyset_and(
+        std::move(terms[i].at_or_after),
+        detail::keyset_or(std::move(terms[i].after), std::move(condition)));
+  }
+
+  switch (condition._kind) {
+    case detail::keyset_term_t::kind::always:
+      return to_sql_string(context, true);
+    case detail::keyset_term_t::kind::never:
+      return to_sql_string(context, false);
+    case detail::keyset_term_t::kind::condition:
+      break;
+  }
+  if (condition._has_parentheses) {
+    return condition._sql;
+  }
+  return "(" + condition._sql + ")";
+}
+
+// The sort order of a keyset (aka seek) pagination, see docs/select.md.
+template <typename... SortOrders>
+class keyset_t {
+ public:
+  explicit keyset_t(SortOrders... sort_orders)
+      : _sort_orders(std::move(sort_orders)...) {}
+  keyset_t(const keyset_t&) = default;
+  keyset_t(keyset_t&&) = default;
+  keyset_t& operator=(const keyset_t&) = default;
+  keyset_t& operator=(keyset_t&&) = default;
+  ~keyset_t() = default;
+
+  // Condition for the rows after the row with the given key values, e.g. the
+  // last row of the previous page.
+  template <typename... Values>
+    requires(sizeof...(Values) == sizeof...(SortOrders) and
+             (values_are_comparable<detail::keyset_column_t<SortOrders>,
+                                    Values>::value and
+              ...))
+  auto after(Values... values) const
+      -> keyset_after_t<std::tuple<SortOrders...>, std::tuple<Values...>> {
+    return {_sort_orders, std::tuple<Values...>{std::move(values)...}};
+  }
+
+  // Like after(), but with parameters for prepared statements. The parameters
+  // are set from result rows by keyset_pages().
+  auto after_parameters() const {
+    static_assert(
+        not(can_be_null<detail::keyset_column_t<SortOrders>>::value or ...),
+        "keyset parameters require non-nullable keys");
+    return _after_parameters(std::index_sequence_for<SortOrders...>{});
+  }
+
+  // Adds ORDER BY with the keys to a statement.
+  template <typename Statement>
+  auto order_by(Statement statement) const {
+    return std::apply(
+        [&statement](const auto&... sort_orders) {
+          return std::move(statement).order_by(sort_orders...);
+        },
+        _sort_orders);
+  }
+
+  // Copies the key values of a result row into the parameters of a statement
+  // prepared with after_parameters().
+  template <typename Parameters, typename Row>
+  static void _set_parameters(Parameters& parameters, const Row& row) {
+    [&]<size_t... Is>(std::index_sequence<Is...>) {
+      (_set_parameter<detail::keyset_column_t<SortOrders>,
+                      Is + 1 == sizeof...(SortOrders)>(parameters, row),
+       ...);
+    }(std::index_sequence_for<SortOrders...>{});
+  }
+
+ private:
+  template <size_t... Is>
+  auto _after_parameters(std::index_sequence<Is...>) const {
+    using _values_t = std::tuple<detail::keyset_parameters_t<
+        detail::keyset_column_t<SortOrders>,
+        Is + 1 == sizeof...(SortOrders)>...>;
+    return keyset_after_t<std::tuple<SortOrders...>, _values_t>{
+        _sort_orders, _values_t{}};
+  }
+
+  template <typename Column, bool IsLast, typename Parameters, typename Row>
+  static void _set_parameter(Parameters& parameters, const Row& row) {
+    using _parameters_t = detail::keyset_parameters_t<Column, IsLast>;
+    const auto& value = detail::field_by_name_tag<name_tag_of_t<Column>>(row);
+    if constexpr (not IsLast) {
+      static_cast<typename _parameters_t::_at_or_after_t::_instance_t&>(
+          parameters)() = value;
+    }
+    static_cast<typename _parameters_t::_after_t::_instance_t&>(parameters)() =
+        value;
+  }
+
+  std::tuple<SortOrders...> _sort_orders;
+};
+
+template <typename... SortOrders>
+  requires(sizeof...(SortOrders) > 0 and
+           (is_sort_order<SortOrders>::value and ...))
+auto keyset(SortOrders... sort_orders) -> keyset_t<SortOrders...> {
+  return keyset_t<SortOrders...>{std::move(sort_orders)...};
+}
+
+// Iterates over the rows of all pages of a keyset pagination, see
+// docs/select.md.
+//
+// The first page is read with `first`, all others with `next`, a statement
+// that was prepared with `after_parameters()` of the same keyset.
+template <typename Db, typename Keyset, typename First, typename Next>
+class keyset_pages_t {
+  using _result_t = decltype(std::declval<Db&>()(std::declval<First&>()));
+  static_assert(
+      std::is_same_v<_result_t,
+                     decltype(std::declval<Db&>()(std::declval<Next&>()))>,
+      "keyset_pages requires the same result type for all pages");
+  using _row_t = std::remove_cvref_t<decltype(std::declval<_result_t&>().front())>;
+
+ public:
+  keyset_pages_t(Db& db, First first, Next next, size_t page_size)
+      : _db(db),
+        _first(std::move(first)),
+        _next(std::move(next)),
+        _page_size(page_size) {
+    _start_page(_db(_first));
+  }
+
+  keyset_pages_t(const keyset_pages_t&) = delete;
+  keyset_pages_t(keyset_pages_t&&) = delete;
+  keyset_pages_t& operator=(const keyset_pages_t&) = delete;
+  keyset_pages_t& operator=(keyset_pages_t&&) = delete;
+  ~keyset_pages_t() = default;
+
+  // Iterator
+  class iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = _row_t;
+    using pointer = const _row_t*;
+    using reference = const _row_t&;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+
+    explicit iterator(keyset_pages_t& pages) : _pages_ptr(&pages) {}
+
+    reference operator*() const { return _pages_ptr->front(); }
+
+    pointer operator->() const { return &_pages_ptr->front(); }
+
+    bool operator==(const iterator& rhs) const {
+      return _is_end() == rhs._is_end();
+    }
+
+    bool operator!=(const iterator& rhs) const { return not(operator==(rhs)); }
+
+    iterator& operator++() {
+      _pages_ptr->pop_front();
+      return *this;
+    }
+
+    // See result_t::iterator
+    void operator++(int) { ++*this; }
+
+   private:
+    bool _is_end() const {
+      return _pages_ptr == nullptr or _pages_ptr->empty();
+    }
+
+    keyset_pages_t* _pages_ptr = nullptr;
+  };
+
+  iterator begin() { return iterator(*this); }
+
+  iterator end() { return iterator(); }
+
+  const _row_t& front() const { return _result->front(); }
+
+  bool empty() const { return not _result.has_value(); }
+
+  void pop_front() {
+    // The last row of a full page determines where the next page starts.
+    const bool is_last_of_page = ++_rows_on_page == _page_size;
+    if (is_last_of_page) {
+      Keyset::_set_parameters(_next.parameters, _result->front());
+    }
+    _result->pop_front();
+    if (_result->empty()) {
+      _result.reset();
+      if (is_last_of_page) {
+        _start_page(_db(_next));
+      }
+    }
+  }
+
+  // The number of pages read so far.
+  auto page_count() const -> size_t { return _page_count; }
+
+ private:
+  void _start_page(_result_t&& result) {
+    _rows_on_page = 0;
+    if (not result.empty()) {
+      ++_page_count;
+      _result.emplace(std::move(result));
+    }
+  }
+
+  Db& _db;
+  First _first;
+  Next _next;
+  size_t _page_size;
+  size_t _rows_on_page = 0;
+  size_t _page_count = 0;
+  std::optional<_result_t> _result;
+};
+
+// Walks all rows of a keyset pagination. `make_statement` is called with a
+// condition (TRUE for the first page, keyset.after_parameters() for all
+// others) and returns the select statement without ORDER BY and LIMIT. Both
+// statements are prepared once.
+template <typename Db, typename... SortOrders, typename MakeStatement>
+auto keyset_pages(Db& db,
+                  const keyset_t<SortOrders...>& keyset,
+                  size_t page_size,
+                  MakeStatement make_statement) {
+  auto make_page = [&](auto condition) {
+    return keyset.order_by(make_statement(std::move(condition)))
+        .limit(page_size);
+  };
+  auto first = db.prepare(make_page(sqlpp::value(true)));
+  auto next = db.prepare(make_page(keyset.after_parameters()));
+  return keyset_pages_t<Db, keyset_t<SortOrders...>, decltype(first),
+                        decltype(next)>{db, std::move(first), std::move(next),
+                                        page_size};
+}
+}  // namespace sqlpp
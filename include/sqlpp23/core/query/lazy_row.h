@@ -0,0 +1,237 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <sqlpp23/core/query/bind_field.h>
+#include <sqlpp23/core/query/read_field.h>
+#include <sqlpp23/core/query/result_row.h>
+#include <sqlpp23/core/query/statement_handler.h>
+#include <sqlpp23/core/result.h>
+#include <sqlpp23/core/type_traits.h>
+#include <sqlpp23/core/wrong.h>
+
+namespace sqlpp {
+namespace detail {
+// Shared by all fields of a lazy row: the connector result positioned at the
+// current row and a counter that changes with every row.
+template <typename DbResult>
+struct lazy_row_state_t {
+  DbResult* _result = nullptr;
+  size_t _generation = 0;
+};
+
+// Owns the connector result on the heap, so that lazy rows can keep pointing
+// to it while the surrounding result_t is moved.
+template <typename DbResult>
+class lazy_db_result_t {
+  std::unique_ptr<DbResult> _result;
+
+ public:
+  lazy_db_result_t() = default;
+  lazy_db_result_t(DbResult&& result)
+      : _result(std::make_unique<DbResult>(std::move(result))) {}
+
+  template <typename ResultRow>
+  void next(ResultRow& result_row) {
+    _result->next(result_row);
+  }
+
+  auto size() const
+    requires requires(const DbResult& result) { result.size(); }
+  {
+    return _result->size();
+  }
+};
+
+template <std::size_t index, typename FieldSpec, typename DbResult>
+struct lazy_result_field;
+}  // namespace detail
+
+// A field of a lazy row. The value is read from the connector result when it
+// is first accessed for the current row.
+template <std::size_t Index, typename Field, typename DbResult>
+class lazy_field_t {
+ public:
+  lazy_field_t() = default;
+  lazy_field_t(const lazy_field_t&) = delete;
+  lazy_field_t(lazy_field_t&&) = default;
+  lazy_field_t& operator=(const lazy_field_t&) = delete;
+  lazy_field_t& operator=(lazy_field_t&&) = default;
+
+  const Field& operator()() const {
+    if (_generation != _state->_generation) {
+      read_field(*_state->_result, Index, _value);
+      _generation = _state->_generation;
+    }
+    return _value;
+  }
+
+  operator const Field&() const { return operator()(); }
+
+ private:
+  template <std::size_t, typename, typename>
+  friend struct detail::lazy_result_field;
+
+  const detail::lazy_row_state_t<DbResult>* _state = nullptr;
+  mutable size_t _generation = 0;
+  mutable Field _value = {};
+};
+
+namespace detail {
+template <std::size_t index, typename FieldSpec, typename DbResult>
+struct lazy_result_field
+    : public member_t<FieldSpec,
+                      lazy_field_t<index,
+                                   typename FieldSpec::result_data_type,
+                                   DbResult>> {
+  using _field = member_t<
+      FieldSpec,
+      lazy_field_t<index, typename FieldSpec::result_data_type, DbResult>>;
+
+ protected:
+  lazy_result_field() = default;
+
+  void _attach(const lazy_row_state_t<DbResult>* state) {
+    _field::operator()()._state = state;
+  }
+
+  // Binding only depends on the field type, so a temporary will do.
+  template <typename Target>
+  static void _bind_field(Target& target) {
+    auto field = typename FieldSpec::result_data_type{};
+    bind_field(target, index, field);
+  }
+};
+
+template <typename IndexSequence, typename DbResult, typename... FieldSpecs>
+struct lazy_row_impl;
+
+template <std::size_t... Is, typename DbResult, typename... FieldSpecs>
+struct lazy_row_impl<std::index_sequence<Is...>, DbResult, FieldSpecs...>
+    : public lazy_result_field<Is, FieldSpecs, DbResult>... {
+ protected:
+  lazy_row_impl() = default;
+
+  void _attach(const lazy_row_state_t<DbResult>* state) {
+    (lazy_result_field<Is, FieldSpecs, DbResult>::_attach(state), ...);
+  }
+
+  template <typename Target>
+  void _bind_fields(Target& target) {
+    (lazy_result_field<Is, FieldSpecs, DbResult>::_bind_field(target), ...);
+  }
+};
+}  // namespace detail
+
+// A result row that defers reading fields until they are accessed, see
+// connection::select_lazy(). Fields are accessed via `row.id()` or by
+// conversion to the field type. Values are read at most once per row.
+template <typename ResultRow, typename DbResult>
+struct lazy_row_t {
+  static_assert(wrong_t<lazy_row_t>::value,
+                "select_lazy requires a select statement");
+};
+
+template <typename... FieldSpecs, typename DbResult>
+struct lazy_row_t<result_row_t<FieldSpecs...>, DbResult>
+    : public detail::lazy_row_impl<std::index_sequence_for<FieldSpecs...>,
+                                   DbResult,
+                                   FieldSpecs...> {
+  lazy_row_t() { _impl::_attach(&_state); }
+
+  lazy_row_t(const lazy_row_t&) = delete;
+  lazy_row_t(lazy_row_t&& rhs)
+      : _impl(std::move(rhs)), _state(rhs._state), _is_valid(rhs._is_valid) {
+    _impl::_attach(&_state);
+  }
+  lazy_row_t& operator=(const lazy_row_t&) = delete;
+  lazy_row_t& operator=(lazy_row_t&& rhs) {
+    _impl::operator=(std::move(rhs));
+    _state = rhs._state;
+    _is_valid = rhs._is_valid;
+    _impl::_attach(&_state);
+    return *this;
+  }
+
+  bool operator==(const lazy_row_t& rhs) const {
+    return _is_valid == rhs._is_valid;
+  }
+
+  explicit operator bool() const { return _is_valid; }
+
+ private:
+  friend class detail::result_row_bridge;
+  using _impl = detail::lazy_row_impl<std::index_sequence_for<FieldSpecs...>,
+                                      DbResult,
+                                      FieldSpecs...>;
+
+  void _validate() { _is_valid = true; }
+
+  void _invalidate() { _is_valid = false; }
+
+  template <typename Target>
+  void _bind_fields(Target& target) {
+    _impl::_bind_fields(target);
+  }
+
+  // Called for every row: Only remembers the position, fields are read on
+  // access.
+  void _read_fields(DbResult& result) {
+    _state._result = &result;
+    ++_state._generation;
+  }
+
+  detail::lazy_row_state_t<DbResult> _state;
+  bool _is_valid{false};
+};
+
+namespace detail {
+// Runs a select statement or a prepared select, returning a result with rows
+// of type lazy_row_t<...>. Used by connection::select_lazy().
+template <typename Statement, typename Db>
+auto select_lazy(Statement&& statement, Db& db) {
+  using _statement_t = std::decay_t<Statement>;
+  if constexpr (is_prepared_statement_v<_statement_t>) {
+    using _db_result_t =
+        decltype(statement_handler_t{}.run_prepared_select(statement, db));
+    using _row_t = lazy_row_t<typename _statement_t::_result_row_t, _db_result_t>;
+    return result_t<lazy_db_result_t<_db_result_t>, _row_t>{
+        statement_handler_t{}.run_prepared_select(statement, db)};
+  } else {
+    using _db_result_t = decltype(statement_handler_t{}.select(statement, db));
+    using _row_t = lazy_row_t<get_result_row_t<_statement_t>, _db_result_t>;
+    return result_t<lazy_db_result_t<_db_result_t>, _row_t>{
+        statement_handler_t{}.select(statement, db)};
+  }
+}
+}  // namespace detail
+}  // namespace sqlpp
@@ -0,0 +1,236 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/query/to_vector.h>
+
+namespace sqlpp {
+// Iterates over the rows of a select result, while a helper thread fetches and
+// decodes the next batches of rows, see docs/select.md.
+//
+// The helper thread owns the result. The connection must not be used until
+// the read_ahead_result_t is destroyed.
+template <typename Result>
+class read_ahead_result_t {
+  using _row_t = std::remove_cvref_t<decltype(std::declval<Result&>().front())>;
+
+  struct batch_t {
+    std::pmr::monotonic_buffer_resource arena;
+    std::optional<std::pmr::vector<_row_t>> rows;
+  };
+
+ public:
+  read_ahead_result_t(Result&& result, size_t batch_size, size_t max_batches)
+      : _result(std::move(result)), _batch_size(std::max<size_t>(batch_size, 1)) {
+    // One batch is read by the caller while the others are being filled.
+    for (size_t i = 0; i < std::max<size_t>(max_batches, 2); ++i) {
+      _batches.push_back(std::make_unique<batch_t>());
+      _free.push_back(_batches.back().get());
+    }
+    _thread = std::thread([this] { _fill_batches(); });
+    try {
+      _next_batch();
+    } catch (...) {
+      _stop_thread();
+      throw;
+    }
+  }
+
+  read_ahead_result_t(const read_ahead_result_t&) = delete;
+  read_ahead_result_t(read_ahead_result_t&&) = delete;
+  read_ahead_result_t& operator=(const read_ahead_result_t&) = delete;
+  read_ahead_result_t& operator=(read_ahead_result_t&&) = delete;
+  ~read_ahead_result_t() { _stop_thread(); }
+
+  // Iterator
+  class iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = _row_t;
+    using pointer = const _row_t*;
+    using reference = const _row_t&;
+    using difference_type = std::ptrdiff_t;
+
+    iterator() = default;
+
+    explicit iterator(read_ahead_result_t& result) : _result_ptr(&result) {}
+
+    reference operator*() const { return _result_ptr->front(); }
+
+    pointer operator->() const { return &_result_ptr->front(); }
+
+    bool operator==(const iterator& rhs) const {
+      return _is_end() == rhs._is_end();
+    }
+
+    bool operator!=(const iterator& rhs) const { return not(operator==(rhs)); }
+
+    iterator& operator++() {
+      _result_ptr->pop_front();
+      return *this;
+    }
+
+    // See result_t::iterator
+    void operator++(int) { ++*this; }
+
+   private:
+    bool _is_end() const {
+      return _result_ptr == nullptr or _result_ptr->empty();
+    }
+
+    read_ahead_result_t* _result_ptr = nullptr;
+  };
+
+  iterator begin() { return iterator(*this); }
+
+  iterator end() { return iterator(); }
+
+  const _row_t& front() const { return (*_current->rows)[_index]; }
+
+  bool empty() const { return _current == nullptr; }
+
+  void pop_front() {
+    if (++_index == _current->rows->size()) {
+      _next_batch();
+    }
+  }
+
+ private:
+  void _stop_thread() {
+    {
+      const auto lock = std::lock_guard{_mutex};
+      _stop = true;
+    }
+    _condition.notify_all();
+    _thread.join();
+  }
+
+  // Runs on the helper thread.
+  void _fill_batches() {
+    try {
+      while (not _result.empty()) {
+        batch_t* batch = nullptr;
+        {
+          auto lock = std::unique_lock{_mutex};
+          _condition.wait(lock, [this] { return _stop or not _free.empty(); });
+          if (_stop) {
+            return;
+          }
+          batch = _free.front();
+          _free.pop_front();
+        }
+
+        batch->rows.emplace(to_vector(_result, batch->arena, _batch_size));
+
+        {
+          const auto lock = std::lock_guard{_mutex};
+          _filled.push_back(batch);
+        }
+        _condition.notify_all();
+      }
+    } catch (...) {
+      const auto lock = std::lock_guard{_mutex};
+      _error = std::current_exception();
+    }
+    {
+      const auto lock = std::lock_guard{_mutex};
+      _done = true;
+    }
+    _condition.notify_all();
+  }
+
+  // Hands the current batch back to the helper thread and waits for the next
+  // one. Rethrows errors of the helper thread once all rows before the error
+  // have been read.
+  void _next_batch() {
+    if (_current) {
+      _current->rows.reset();
+      _current->arena.release();
+      {
+        const auto lock = std::lock_guard{_mutex};
+        _free.push_back(_current);
+      }
+      _condition.notify_all();
+      _current = nullptr;
+    }
+
+    auto lock = std::unique_lock{_mutex};
+    _condition.wait(lock, [this] { return _done or not _filled.empty(); });
+    if (not _filled.empty()) {
+      _current = _filled.front();
+      _filled.pop_front();
+      _index = 0;
+      return;
+    }
+    if (_error) {
+      std::rethrow_exception(std::exchange(_error, nullptr));
+    }
+  }
+
+  Result _result;
+  size_t _batch_size;
+  std::vector<std::unique_ptr<batch_t>> _batches;
+
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::deque<batch_t*> _free;
+  std::deque<batch_t*> _filled;
+  bool _stop = false;
+  bool _done = false;
+  std::exception_ptr _error;
+
+  batch_t* _current = nullptr;
+  size_t _index = 0;
+
+  std::thread _thread;
+};
+
+// Takes ownership of a select result and reads it ahead on a helper thread in
+// batches of `batch_size` rows, holding at most `max_batches` batches.
+template <typename Result>
+  requires(not std::is_lvalue_reference_v<Result>)
+auto read_ahead(Result&& result,
+                size_t batch_size = 1024,
+                size_t max_batches = 2) -> read_ahead_result_t<Result> {
+  return {std::move(result), batch_size, max_batches};
+}
+}  // namespace sqlpp
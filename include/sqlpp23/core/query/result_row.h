@@ -143,21 +143,22 @@ struct result_row_t : public detail::result_row_impl<
 namespace detail {
 class result_row_bridge {
   public:
-  template<typename... FieldSpecs, typename Target>
-  void bind_fields(result_row_t<FieldSpecs...>& row, Target& target) {
+  // Used for result_row_t and other row types, e.g. into_row_t.
+  template<typename Row, typename Target>
+  void bind_fields(Row& row, Target& target) {
     row._bind_fields(target);
   }
 
-  template<typename... FieldSpecs, typename Target>
-  void read_fields(result_row_t<FieldSpecs...>& row, Target& target) {
+  template<typename Row, typename Target>
+  void read_fields(Row& row, Target& target) {
     row._read_fields(target);
   }
 
-  template<typename... FieldSpecs>
-  void validate(result_row_t<FieldSpecs...>& row) { row._validate(); }
+  template<typename Row>
+  void validate(Row& row) { row._validate(); }
 
-  template<typename... FieldSpecs>
-  void invalidate(result_row_t<FieldSpecs...>& row) { row._invalidate(); }
+  template<typename Row>
+  void invalidate(Row& row) { row._invalidate(); }
 };
 }  // namespace detail
 
@@ -0,0 +1,272 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/name/create_reflection_name_tag.h>
+#include <sqlpp23/core/query/bind_field.h>
+#include <sqlpp23/core/query/read_field.h>
+#include <sqlpp23/core/query/result_row.h>
+#include <sqlpp23/core/query/statement_handler.h>
+#include <sqlpp23/core/result.h>
+#include <sqlpp23/core/type_traits.h>
+#include <sqlpp23/core/wrong.h>
+
+#if SQLPP_INCLUDE_REFLECTION == 1
+#include <meta>
+#endif
+
+namespace sqlpp {
+namespace detail {
+#if SQLPP_INCLUDE_REFLECTION == 1
+// The C++ name of a name tag, e.g. `intN` for the column `int_n`, is the name
+// of the single data member of its _member_t. Name tags without such a member
+// (e.g. reflection aliases) use the same name in SQL and C++.
+template <typename NameTag>
+consteval auto cpp_name_of() -> std::string_view {
+  const auto members = std::meta::nonstatic_data_members_of(
+      ^^typename NameTag::template _member_t<int>,
+      std::meta::access_context::unchecked());
+  if (members.size() == 1 and std::meta::has_identifier(members[0])) {
+    return std::meta::identifier_of(members[0]);
+  }
+  return std::string_view{static_cast<const char*>(NameTag::name)};
+}
+
+// The data member of Struct with the C++ or SQL name of NameTag.
+template <typename Struct, typename NameTag>
+consteval auto member_of() -> std::meta::info {
+  const auto cpp_name = cpp_name_of<NameTag>();
+  const auto sql_name =
+      std::string_view{static_cast<const char*>(NameTag::name)};
+  for (const auto member : std::meta::nonstatic_data_members_of(
+           ^^Struct, std::meta::access_context::unchecked())) {
+    if (std::meta::has_identifier(member) and
+        (std::meta::identifier_of(member) == cpp_name or
+         std::meta::identifier_of(member) == sql_name)) {
+      return member;
+    }
+  }
+  return std::meta::info{};
+}
+#endif
+
+// Types that point into buffers owned by someone else, e.g. the connector.
+template <typename T>
+inline constexpr bool is_non_owning_v = false;
+
+template <typename CharT, typename Traits>
+inline constexpr bool is_non_owning_v<std::basic_string_view<CharT, Traits>> =
+    true;
+
+template <typename T, size_t Extent>
+inline constexpr bool is_non_owning_v<std::span<T, Extent>> = true;
+
+template <typename T>
+inline constexpr bool is_non_owning_v<std::optional<T>> = is_non_owning_v<T>;
+
+#if SQLPP_INCLUDE_REFLECTION == 1
+template <typename Struct>
+consteval auto has_non_owning_member() -> bool {
+  for (const auto member : std::meta::nonstatic_data_members_of(
+           ^^Struct, std::meta::access_context::unchecked())) {
+    if (std::meta::extract<bool>(std::meta::substitute(
+            ^^is_non_owning_v,
+            {std::meta::remove_cv(std::meta::type_of(member))}))) {
+      return true;
+    }
+  }
+  return false;
+}
+#endif
+
+// Assigns a field value to a struct member of a different type, e.g. a
+// std::string_view to a std::string.
+template <typename Member, typename Field>
+void assign_field(Member& member, const Field& field) {
+  if constexpr (requires { member.assign(field.begin(), field.end()); }) {
+    // Re-uses the member's capacity.
+    member.assign(field.begin(), field.end());
+  } else {
+    member = static_cast<Member>(field);
+  }
+}
+
+template <typename Member, typename Field>
+void assign_field(std::optional<Member>& member, const Field& field) {
+  if (not member.has_value()) {
+    member.emplace();
+  }
+  assign_field(*member, field);
+}
+
+template <typename Member, typename Field>
+void assign_field(std::optional<Member>& member,
+                  const std::optional<Field>& field) {
+  if (field.has_value()) {
+    assign_field(member, *field);
+  } else {
+    member.reset();
+  }
+}
+
+template <typename Member, typename Field>
+void assign_field(Member&, const std::optional<Field>&) {
+  static_assert(wrong_t<Member>::value,
+                "select_into: nullable columns require std::optional members");
+}
+}  // namespace detail
+
+// A result row that reads fields directly into the members of Struct, see
+// select_into(). Struct members are matched to result columns by name.
+template <typename Struct, typename ResultRow>
+struct into_row_t {
+  static_assert(wrong_t<into_row_t>::value,
+                "select_into requires a select statement");
+};
+
+template <typename Struct, typename... FieldSpecs>
+struct into_row_t<Struct, result_row_t<FieldSpecs...>> : public Struct {
+  into_row_t() = default;
+
+  bool operator==(const into_row_t& rhs) const {
+    return _is_valid == rhs._is_valid;
+  }
+
+  explicit operator bool() const { return _is_valid; }
+
+ private:
+  friend class detail::result_row_bridge;
+
+  void _validate() { _is_valid = true; }
+
+  void _invalidate() { _is_valid = false; }
+
+  template <typename Target>
+  void _bind_fields(Target& target) {
+    _bind_fields_impl(target, std::index_sequence_for<FieldSpecs...>{});
+  }
+
+  template <typename Target>
+  void _read_fields(Target& target) {
+    _read_fields_impl(target, std::index_sequence_for<FieldSpecs...>{});
+  }
+
+  // Binding only depends on the field types, so temporaries will do.
+  template <typename Target, size_t... Is>
+  void _bind_fields_impl(Target& target, std::index_sequence<Is...>) {
+    (_bind_field<typename FieldSpecs::result_data_type>(target, Is), ...);
+  }
+
+  template <typename Field, typename Target>
+  static void _bind_field(Target& target, size_t index) {
+    auto field = Field{};
+    bind_field(target, index, field);
+  }
+
+  template <typename Target, size_t... Is>
+  void _read_fields_impl(Target& target, std::index_sequence<Is...>) {
+    (_read_field<FieldSpecs>(target, Is), ...);
+  }
+
+  template <typename FieldSpec, typename Target>
+  void _read_field(Target& target, size_t index) {
+#if SQLPP_INCLUDE_REFLECTION == 1
+    constexpr auto member = detail::member_of<Struct, name_tag_of_t<FieldSpec>>();
+    static_assert(member != std::meta::info{},
+                  "select_into: struct has no member for result column");
+    using _field_t = typename FieldSpec::result_data_type;
+    auto& destination = static_cast<Struct&>(*this).[:member:];
+    if constexpr (std::is_same_v<std::remove_cvref_t<decltype(destination)>,
+                                 _field_t>) {
+      read_field(target, index, destination);
+    } else {
+      auto field = _field_t{};
+      read_field(target, index, field);
+      detail::assign_field(destination, field);
+    }
+#else
+    static_assert(wrong_t<FieldSpec>::value,
+                  "select_into requires C++26 reflection");
+#endif
+  }
+
+  bool _is_valid{false};
+};
+
+namespace detail {
+// Runs a select statement or a prepared select, returning a result with rows
+// of type into_row_t<Struct, ...>. Used by connection::select_into().
+template <typename Struct, typename Statement, typename Db>
+auto select_into(Statement&& statement, Db& db) {
+  using _statement_t = std::decay_t<Statement>;
+  if constexpr (is_prepared_statement_v<_statement_t>) {
+    using _row_t = into_row_t<Struct, typename _statement_t::_result_row_t>;
+    using _db_result_t =
+        decltype(statement_handler_t{}.run_prepared_select(statement, db));
+    return result_t<_db_result_t, _row_t>{
+        statement_handler_t{}.run_prepared_select(statement, db)};
+  } else {
+    using _row_t = into_row_t<Struct, get_result_row_t<_statement_t>>;
+    using _db_result_t = decltype(statement_handler_t{}.select(statement, db));
+    return result_t<_db_result_t, _row_t>{
+        statement_handler_t{}.select(statement, db)};
+  }
+}
+}  // namespace detail
+
+// Moves all remaining rows of a select_into() result into a vector. Struct
+// must not have std::string_view or std::span members, since those point into
+// connector buffers that are overwritten when the result advances.
+template <typename DbResult, typename Struct, typename ResultRow>
+auto to_vector(result_t<DbResult, into_row_t<Struct, ResultRow>>&& result)
+    -> std::vector<Struct> {
+#if SQLPP_INCLUDE_REFLECTION == 1
+  static_assert(not detail::has_non_owning_member<Struct>(),
+                "to_vector: members of type std::string_view or std::span "
+                "would dangle, use owning types like std::string instead");
+#endif
+  auto rows = std::vector<Struct>{};
+  if constexpr (result_t<DbResult, into_row_t<Struct, ResultRow>>::has_size) {
+    rows.reserve(static_cast<size_t>(result.size()));
+  }
+  for (; not result.empty(); result.pop_front()) {
+    // The row is owned by `result`, which we own. Members without a result
+    // column are reset to their defaults for the next row.
+    auto& row = const_cast<into_row_t<Struct, ResultRow>&>(result.front());
+    rows.push_back(std::exchange(static_cast<Struct&>(row), Struct{}));
+  }
+  return rows;
+}
+}  // namespace sqlpp
@@ -38,9 +38,11 @@ class statement_handler_t {
     return std::forward<Statement>(statement)._run(db);
   }
 
-  template <typename Statement, typename Db>
-  auto prepare(Statement&& statement, Db& db) {
-    return std::forward<Statement>(statement)._prepare(db);
+  // Options are passed on to the connection, e.g. to select a connector
+  // specific way of preparing the statement.
+  template <typename Statement, typename Db, typename... Options>
+  auto prepare(Statement&& statement, Db& db, Options... options) {
+    return std::forward<Statement>(statement)._prepare(db, options...);
   }
 
   template <typename Statement, typename Db>
@@ -68,29 +70,29 @@ class statement_handler_t {
     return db._update(std::forward<Statement>(statement));
   }
 
-  template <typename Statement, typename Db>
-  auto prepare_execute(Statement&& statement, Db& db) {
-    return db._prepare_execute(std::forward<Statement>(statement));
+  template <typename Statement, typename Db, typename... Options>
+  auto prepare_execute(Statement&& statement, Db& db, Options... options) {
+    return db._prepare_execute(std::forward<Statement>(statement), options...);
   }
 
-  template <typename Statement, typename Db>
-  auto prepare_delete_from(Statement&& statement, Db& db) {
-    return db._prepare_delete_from(std::forward<Statement>(statement));
+  template <typename Statement, typename Db, typename... Options>
+  auto prepare_delete_from(Statement&& statement, Db& db, Options... options) {
+    return db._prepare_delete_from(std::forward<Statement>(statement), options...);
   }
 
-  template <typename Statement, typename Db>
-  auto prepare_insert(Statement&& statement, Db& db) {
-    return db._prepare_insert(std::forward<Statement>(statement));
+  template <typename Statement, typename Db, typename... Options>
+  auto prepare_insert(Statement&& statement, Db& db, Options... options) {
+    return db._prepare_insert(std::forward<Statement>(statement), options...);
   }
 
-  template <typename Statement, typename Db>
-  auto prepare_select(Statement&& statement, Db& db) {
-    return db._prepare_select(std::forward<Statement>(statement));
+  template <typename Statement, typename Db, typename... Options>
+  auto prepare_select(Statement&& statement, Db& db, Options... options) {
+    return db._prepare_select(std::forward<Statement>(statement), options...);
   }
 
-  template <typename Statement, typename Db>
-  auto prepare_update(Statement&& statement, Db& db) {
-    return db._prepare_update(std::forward<Statement>(statement));
+  template <typename Statement, typename Db, typename... Options>
+  auto prepare_update(Statement&& statement, Db& db, Options... options) {
+    return db._prepare_update(std::forward<Statement>(statement), options...);
   }
 
   template <typename Statement, typename Db>
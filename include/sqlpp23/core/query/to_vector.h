@@ -0,0 +1,138 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sqlpp23/core/query/result_row.h>
+#include <sqlpp23/core/wrong.h>
+
+namespace sqlpp {
+namespace detail {
+// Text and blob fields are views into connector-owned buffers that are
+// overwritten when the result advances. Copy them into the arena.
+inline std::string_view copy_to_arena(std::pmr::memory_resource& arena,
+                                      std::string_view value) {
+  if (value.empty()) {
+    return {};
+  }
+  auto* data = static_cast<char*>(arena.allocate(value.size(), alignof(char)));
+  std::memcpy(data, value.data(), value.size());
+  return {data, value.size()};
+}
+
+inline std::span<const uint8_t> copy_to_arena(std::pmr::memory_resource& arena,
+                                              std::span<const uint8_t> value) {
+  if (value.empty()) {
+    return {};
+  }
+  auto* data =
+      static_cast<uint8_t*>(arena.allocate(value.size(), alignof(uint8_t)));
+  std::memcpy(data, value.data(), value.size());
+  return {data, value.size()};
+}
+
+// All other result field types are values already.
+template <typename T>
+T copy_to_arena(std::pmr::memory_resource&, const T& value) {
+  return value;
+}
+
+template <typename T>
+std::optional<T> copy_to_arena(std::pmr::memory_resource& arena,
+                               const std::optional<T>& value) {
+  if (not value.has_value()) {
+    return std::nullopt;
+  }
+  return copy_to_arena(arena, *value);
+}
+
+template <typename Row>
+struct arena_row_copier {
+  static_assert(wrong_t<Row>::value, "to_vector requires a select result");
+};
+
+template <typename... FieldSpecs>
+struct arena_row_copier<result_row_t<FieldSpecs...>> {
+  using _row_t = result_row_t<FieldSpecs...>;
+
+  static void copy(std::pmr::memory_resource& arena,
+                   const _row_t& source,
+                   _row_t& target) {
+    _copy_fields(arena, source, target,
+                 std::index_sequence_for<FieldSpecs...>{});
+    result_row_bridge{}.validate(target);
+  }
+
+ private:
+  template <size_t... Is>
+  static void _copy_fields(std::pmr::memory_resource& arena,
+                           const _row_t& source,
+                           _row_t& target,
+                           std::index_sequence<Is...>) {
+    ((static_cast<result_field<Is, FieldSpecs>&>(target)() = copy_to_arena(
+          arena, static_cast<const result_field<Is, FieldSpecs>&>(source)())),
+     ...);
+  }
+};
+}  // namespace detail
+
+// Materializes up to `max_rows` rows of `result`. Text and blob fields of the
+// returned rows point into `arena` instead of connector-owned buffers, so
+// they stay valid after the result advances or is destroyed, for as long as
+// the arena lives. The vector's storage is taken from the arena, too.
+//
+// Using a std::pmr::monotonic_buffer_resource as arena replaces one
+// allocation per variable-length field with a bump allocation.
+template <typename Result>
+auto to_vector(Result&& result,
+               std::pmr::memory_resource& arena,
+               size_t max_rows = std::numeric_limits<size_t>::max()) {
+  using _result_t = std::remove_cvref_t<Result>;
+  using _row_t = std::remove_cvref_t<decltype(result.front())>;
+
+  std::pmr::vector<_row_t> rows(&arena);
+  if constexpr (_result_t::has_size) {
+    rows.reserve(std::min(static_cast<size_t>(result.size()), max_rows));
+  }
+  for (; rows.size() < max_rows and not result.empty(); result.pop_front()) {
+    detail::arena_row_copier<_row_t>::copy(arena, result.front(),
+                                           rows.emplace_back());
+  }
+  return rows;
+}
+}  // namespace sqlpp
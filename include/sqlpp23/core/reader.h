@@ -97,6 +97,103 @@ struct reader_t {
   const auto& else_(const T& t) const {
     return t._else;
   }
+  template <typename T>
+  const auto& partition_by(const T& t) const {
+    return t._partition_by;
+  }
+  template <typename T>
+  const auto& order_by(const T& t) const {
+    return t._order_by;
+  }
+  template <typename T>
+  const auto& frame(const T& t) const {
+    return t._frame;
+  }
+
+  // True if T has any of the members visited by for_each_operand().
+  template <typename T>
+  static constexpr bool has_operands =
+      requires(const T& t) { t._assignments; } or
+      requires(const T& t) { t._column; } or
+      requires(const T& t) { t._columns; } or
+      requires(const T& t) { t._condition; } or
+      requires(const T& t) { t._ctes; } or
+      requires(const T& t) { t._else; } or
+      requires(const T& t) { t._expression; } or
+      requires(const T& t) { t._expressions; } or
+      requires(const T& t) { t._flags; } or
+      requires(const T& t) { t._lhs; } or
+      requires(const T& t) { t._rhs; } or
+      requires(const T& t) { t._on_conflict; } or
+      requires(const T& t) { t._on_conflict_update; } or
+      requires(const T& t) { t._order_by; } or
+      requires(const T& t) { t._partition_by; } or
+      requires(const T& t) { t._table; } or
+      requires(const T& t) { t._then; } or
+      requires(const T& t) { t._when; } or
+      requires(const T& t) { t._when_then_list; };
+
+  // Calls `f` with each member of `t` that can hold sub-expressions.
+  template <typename T, typename F>
+  void for_each_operand(const T& t, const F& f) const {
+    if constexpr (requires { t._assignments; }) {
+      f(t._assignments);
+    }
+    if constexpr (requires { t._column; }) {
+      f(t._column);
+    }
+    if constexpr (requires { t._columns; }) {
+      f(t._columns);
+    }
+    if constexpr (requires { t._condition; }) {
+      f(t._condition);
+    }
+    if constexpr (requires { t._ctes; }) {
+      f(t._ctes);
+    }
+    if constexpr (requires { t._else; }) {
+      f(t._else);
+    }
+    if constexpr (requires { t._expression; }) {
+      f(t._expression);
+    }
+    if constexpr (requires { t._expressions; }) {
+      f(t._expressions);
+    }
+    if constexpr (requires { t._flags; }) {
+      f(t._flags);
+    }
+    if constexpr (requires { t._lhs; }) {
+      f(t._lhs);
+    }
+    if constexpr (requires { t._rhs; }) {
+      f(t._rhs);
+    }
+    if constexpr (requires { t._on_conflict; }) {
+      f(t._on_conflict);
+    }
+    if constexpr (requires { t._on_conflict_update; }) {
+      f(t._on_conflict_update);
+    }
+    if constexpr (requires { t._order_by; }) {
+      f(t._order_by);
+    }
+    if constexpr (requires { t._partition_by; }) {
+      f(t._partition_by);
+    }
+    if constexpr (requires { t._table; }) {
+      f(t._table);
+    }
+    if constexpr (requires { t._then; }) {
+      f(t._then);
+    }
+    if constexpr (requires { t._when; }) {
+      f(t._when);
+    }
+    if constexpr (requires { t._when_then_list; }) {
+      f(t._when_then_list);
+    }
+  }
 };
 
 inline constexpr auto read = reader_t{};
@@ -64,6 +64,8 @@ class result_t {
   result_row_t _end_row;
 
  public:
+  static constexpr bool has_size = detail::result_has_size<DbResult>::value;
+
   result_t() = default;
 
   result_t(db_result_t&& result) : _result(std::move(result)), _result_row() {
@@ -30,6 +30,8 @@
 #include <array>
 #include <cmath>
 #include <format>
+#include <iterator>
+#include <limits>
 #include <optional>
 #include <span>
 #include <string>
@@ -37,6 +39,7 @@
 
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/database/exception.h>
+#include <sqlpp23/core/detail/hex.h>
 #include <sqlpp23/core/type_traits.h>
 
 namespace sqlpp {
@@ -109,18 +112,29 @@ auto neg_inf_to_sql_string(Context&) -> std::string {
       "Serialization of Infinity is not supported by this connector");
 }
 
-template <typename Context, typename T>
-auto float_to_sql_string(Context& context, const T& f) -> std::string {
+// Like float_to_sql_string(), but appends to `out`, e.g. to re-use the
+// capacity of a parameter buffer. `String` can be any std::basic_string<char>,
+// e.g. std::pmr::string.
+template <typename Context, typename String, typename T>
+void append_float_to_sql_string(Context& context, String& out, const T& f) {
   if (std::isnan(f)) {
-    return nan_to_sql_string(context);
+    out += nan_to_sql_string(context);
   } else if (std::isinf(f)) {
-    return f > std::numeric_limits<T>::max() ? inf_to_sql_string(context)
+    out += f > std::numeric_limits<T>::max() ? inf_to_sql_string(context)
                                              : neg_inf_to_sql_string(context);
   } else {
-    return std::format("{:.{}g}", f, std::numeric_limits<T>::digits10);
+    std::format_to(std::back_inserter(out), "{:.{}g}", f,
+                   std::numeric_limits<T>::digits10);
   }
 }
 
+template <typename Context, typename T>
+auto float_to_sql_string(Context& context, const T& f) -> std::string {
+  auto result = std::string{};
+  append_float_to_sql_string(context, result, f);
+  return result;
+}
+
 template <typename Context>
 auto to_sql_string(Context& context, const float& t) -> std::string {
   return float_to_sql_string(context, t);
@@ -166,17 +180,9 @@ auto to_sql_string(Context& context, const char& t) -> std::string {
 // The PostgreSQL connector therefore specializes this function.
 template <typename Context>
 auto to_sql_string(Context&, const std::span<const uint8_t>& t) -> std::string {
-  constexpr char hexChars[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
-                                 '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
-  auto result = std::string{"x'"};
-  result.reserve(t.size() * 2 + 3);
-
-  for (const auto c : t) {
-    result.push_back(hexChars[c >> 4]);
-    result.push_back(hexChars[c & 0x0F]);
-  }
-  result.push_back('\'');
-
+  auto result = std::string(t.size() * 2 + 3, '\'');
+  result[0] = 'x';
+  detail::hex_encode(t.data(), t.size(), result.data() + 2);
   return result;
 }
 
@@ -286,6 +286,11 @@ struct parameters_of<detail::type_vector<T...>> {
 template <typename T>
 using parameters_of_t = typename parameters_of<T>::type;
 
+// True if T holds values that show up in its serialization, but are not
+// exposed as nodes, e.g. the direction of a sort order or the offset of lag().
+template <typename T>
+struct holds_sql_values : public std::false_type {};
+
 // Something that can be used as a table
 template <typename T>
 struct is_table : public std::false_type {};
@@ -582,4 +587,10 @@ using table_of_t = typename table_of<T>::type;
 template <typename T>
 inline constexpr bool contains_for_update_v = contains_for_update<T>::value;
 
+// Whether NULL sorts before other values in ascending order (and after them in
+// descending order) if neither nulls_first() nor nulls_last() is specified.
+// Connectors specialize this for their serializer context.
+template <typename Context>
+struct nulls_sort_first : public std::true_type {};
+
 }  // namespace sqlpp
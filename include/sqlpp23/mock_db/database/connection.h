@@ -28,8 +28,12 @@
 
 #include <sqlpp23/core/basic/schema.h>
 #include <sqlpp23/core/database/connection.h>
+#include <sqlpp23/core/database/execute_many.h>
+#include <sqlpp23/core/database/serialization_cache.h>
 #include <sqlpp23/core/database/transaction.h>
+#include <sqlpp23/core/query/lazy_row.h>
 #include <sqlpp23/core/query/result_row.h>
+#include <sqlpp23/core/query/select_into.h>
 #include <sqlpp23/core/query/statement.h>
 #include <sqlpp23/core/query/statement_handler.h>
 #include <sqlpp23/core/to_sql_string.h>
@@ -70,6 +74,7 @@ class connection_base : public sqlpp::connection {
   using _config_t = connection_config;
   using _config_ptr_t = std::shared_ptr<const _config_t>;
   using _handle_t = detail::connection_handle;
+  using _context_t = context_t;
 
   // Directly executed statements start here
   template <typename T>
@@ -175,10 +180,62 @@ class connection_base : public sqlpp::connection {
     return sqlpp::statement_handler_t{}.prepare(t, *this);
   }
 
+  //! Like prepare(t), but the serialized statement is memoized in `cache`,
+  //! keyed by the statement type and its sqlpp::dynamic_shape(). Values other
+  //! than parameters (e.g. `tab.id == 5`) are rejected at compile time.
+  template <typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto prepare(const T& t, sqlpp::serialization_cache& cache) {
+    sqlpp::serialization_cache_check_t<T>{}.verify();
+    return _prepared_sql.with_cache(cache, [&] { return prepare(t); });
+  }
+
+  //! Executes a prepared insert, update, delete or execute statement once per
+  //! element of `rows` (tuples of parameter values) within a transaction.
+  //! Returns the total number of affected rows.
+  template <typename PreparedStatement, typename Range>
+    requires(sqlpp::is_prepared_statement_v<PreparedStatement>)
+  size_t execute_many(PreparedStatement& prepared, const Range& rows) {
+    return sqlpp::detail::execute_many(*this, prepared, rows);
+  }
+
+  //! Like operator() for select statements, but reads each row directly into
+  //! a Struct, matching members and result columns by name. Requires C++26
+  //! reflection, see docs/select.md.
+  template <typename Struct, typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto select_into(const T& t) {
+    sqlpp::check_run_consistency(t).verify();
+    sqlpp::check_compatibility<context_t>(t).verify();
+    return sqlpp::detail::select_into<Struct>(t, *this);
+  }
+
+  template <typename Struct, typename T>
+    requires(sqlpp::is_prepared_statement_v<std::decay_t<T>>)
+  auto select_into(T&& t) {
+    return sqlpp::detail::select_into<Struct>(std::forward<T>(t), *this);
+  }
+
+  //! Like operator() for select statements, but reads fields only when they
+  //! are accessed, e.g. via `row.id()`. See docs/select.md.
+  template <typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto select_lazy(const T& t) {
+    sqlpp::check_run_consistency(t).verify();
+    sqlpp::check_compatibility<context_t>(t).verify();
+    return sqlpp::detail::select_lazy(t, *this);
+  }
+
+  template <typename T>
+    requires(sqlpp::is_prepared_statement_v<std::decay_t<T>>)
+  auto select_lazy(T&& t) {
+    return sqlpp::detail::select_lazy(std::forward<T>(t), *this);
+  }
+
   template <typename DeleteFrom>
   _prepared_statement_t _prepare_delete_from(const DeleteFrom& x) {
     context_t context;
-    const auto query = to_sql_string(context, x);
+    const auto query = _prepared_sql(context, x);
     return prepare_impl(query,
                         parameters_of_t<std::decay_t<DeleteFrom>>::size());
   }
@@ -186,7 +243,7 @@ class connection_base : public sqlpp::connection {
   template <typename Statement>
   _prepared_statement_t _prepare_execute(const Statement& x) {
     context_t context;
-    const auto query = to_sql_string(context, x);
+    const auto query = _prepared_sql(context, x);
     return prepare_impl(query,
                         parameters_of_t<std::decay_t<Statement>>::size());
   }
@@ -194,21 +251,21 @@ class connection_base : public sqlpp::connection {
   template <typename Insert>
   _prepared_statement_t _prepare_insert(const Insert& x) {
     context_t context;
-    const auto query = to_sql_string(context, x);
+    const auto query = _prepared_sql(context, x);
     return prepare_impl(query, parameters_of_t<std::decay_t<Insert>>::size());
   }
 
   template <typename Select>
   _prepared_statement_t _prepare_select(const Select& x) {
     context_t context;
-    const auto query = to_sql_string(context, x);
+    const auto query = _prepared_sql(context, x);
     return prepare_impl(query, parameters_of_t<std::decay_t<Select>>::size());
   }
 
   template <typename Update>
   _prepared_statement_t _prepare_update(const Update& x) {
     context_t context;
-    const auto query = to_sql_string(context, x);
+    const auto query = _prepared_sql(context, x);
     return prepare_impl(query, parameters_of_t<std::decay_t<Update>>::size());
   }
 
@@ -252,10 +309,12 @@ class connection_base : public sqlpp::connection {
 
   void start_transaction() {
     _mock_data._last_isolation_level = _mock_data._default_isolation_level;
+    _transaction_active = true;
   }
 
   void start_transaction(sqlpp::isolation_level level) {
     _mock_data._last_isolation_level = level;
+    _transaction_active = true;
   }
 
   void set_default_isolation_level(sqlpp::isolation_level level) {
@@ -266,9 +325,11 @@ class connection_base : public sqlpp::connection {
     return _mock_data._default_isolation_level;
   }
 
-  void rollback_transaction() {}
+  void rollback_transaction() { _transaction_active = false; }
+
+  void commit_transaction() { _transaction_active = false; }
 
-  void commit_transaction() {}
+  bool is_transaction_active() { return _transaction_active; }
 
   void report_rollback_failure(std::string) {}
 
@@ -276,6 +337,10 @@ class connection_base : public sqlpp::connection {
   detail::IsolationMockData _mock_data;
   MockRes _mock_result_data;
 
+ private:
+  bool _transaction_active{false};
+  sqlpp::detail::prepared_sql_t _prepared_sql;
+
  protected:
   _handle_t _handle;
 
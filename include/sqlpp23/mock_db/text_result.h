@@ -36,6 +36,7 @@
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/database/exception.h>
 #include <sqlpp23/core/detail/parse_date_time.h>
+#include <sqlpp23/core/detail/parse_number.h>
 #include <sqlpp23/core/query/result_row.h>
 #include <sqlpp23/mock_db/database/connection_config.h>
 
@@ -102,7 +103,7 @@ class text_result_t {
 
   auto& debug() const { return _config->debug; }
   bool get_is_null(size_t field_index) const {
-    return _mock_res->rows[_row_index][field_index].has_value();
+    return not _mock_res->rows[_row_index][field_index].has_value();
   }
   std::string& get_field(size_t index) {
     return _mock_res->rows[_row_index][index].value();
@@ -137,19 +138,19 @@ inline void read_field(const text_result_t& result, size_t index, bool& value) {
 inline void read_field(const text_result_t& result,
                        size_t index,
                        double& value) {
-  value = std::strtod(result.get_field(index).c_str(), nullptr);
+  ::sqlpp::detail::parse_number(value, result.get_field(index));
 }
 
 inline void read_field(const text_result_t& result,
                        size_t index,
                        int64_t& value) {
-  value = std::strtoll(result.get_field(index).c_str(), nullptr, 10);
+  ::sqlpp::detail::parse_number(value, result.get_field(index));
 }
 
 inline void read_field(const text_result_t& result,
                        size_t index,
                        uint64_t& value) {
-  value = std::strtoull(result.get_field(index).c_str(), nullptr, 10);
+  ::sqlpp::detail::parse_number(value, result.get_field(index));
 }
 inline void read_field(const text_result_t& result,
                        size_t index,
@@ -174,7 +175,7 @@ inline void read_field(const text_result_t& result,
                        index);
   }
 
-  const char* date_string = result.get_field(index).c_str();
+  auto date_string = std::string_view(result.get_field(index));
   if constexpr (debug_enabled) {
     result.debug().log(log_category::result, "date string: {}", date_string);
   }
@@ -186,7 +187,7 @@ inline void read_field(const text_result_t& result,
     }
   }
 
-  if (*date_string) {
+  if (not date_string.empty()) {
     if constexpr (debug_enabled) {
       result.debug().log(log_category::result,
                          "trailing characters in date result: {}", date_string);
@@ -202,7 +203,7 @@ inline void read_field(const text_result_t& result,
                        index);
   }
 
-  const char* date_time_string = result.get_field(index).c_str();
+  auto date_time_string = std::string_view(result.get_field(index));
   if constexpr (debug_enabled) {
     result.debug().log(log_category::result, "date_time string: {}",
                        date_time_string);
@@ -215,7 +216,7 @@ inline void read_field(const text_result_t& result,
     }
   }
 
-  if (*date_time_string) {
+  if (not date_time_string.empty()) {
     if constexpr (debug_enabled) {
       result.debug().log(log_category::result,
                          "trailing characters in date_time result: {}",
@@ -232,7 +233,7 @@ inline void read_field(const text_result_t& result,
                        "parsing time of day result at index: {}", index);
   }
 
-  const char* time_string = result.get_field(index).c_str();
+  auto time_string = std::string_view(result.get_field(index));
   if constexpr (debug_enabled) {
     result.debug().log(log_category::result, "time of day string: {}",
                        time_string);
@@ -245,7 +246,7 @@ inline void read_field(const text_result_t& result,
     }
   }
 
-  if (*time_string) {
+  if (not time_string.empty()) {
     if constexpr (debug_enabled) {
       result.debug().log(log_category::result,
                          "trailing characters in time result: {}", time_string);
@@ -27,8 +27,11 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <memory>
+#include <memory_resource>
 #include <span>
 #include <string_view>
+#include <vector>
 
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/query/result_row.h>
@@ -37,25 +40,46 @@
 #include <sqlpp23/mysql/sqlpp_mysql.h>
 
 namespace sqlpp::mysql {
-class bind_result_t {
-  struct bind_result_buffer {
-    unsigned long length;
-    my_bool is_null;
-    my_bool error;
-    union  // unnamed union injects members into scope
-    {
-      bool bool_;
-      int64_t int64_;
-      uint64_t uint64_;
-      double double_;
-      MYSQL_TIME mysql_time_;
-    };
-    std::vector<char> var_buffer;  // text and blobs
+namespace detail {
+struct bind_result_buffer {
+  explicit bind_result_buffer(std::pmr::memory_resource* memory_resource)
+      : var_buffer{memory_resource} {}
+
+  unsigned long length{};
+  my_bool is_null{};
+  my_bool error{};
+  union  // unnamed union injects members into scope
+  {
+    bool bool_;
+    int64_t int64_;
+    uint64_t uint64_;
+    double double_;
+    MYSQL_TIME mysql_time_;
   };
+  std::pmr::vector<char> var_buffer;  // text and blobs
+};
+
+// Owned by a prepared statement and re-used by each of its results, so that
+// warm buffers do not need to be allocated again.
+struct bind_result_buffers_t {
+  explicit bind_result_buffers_t(std::pmr::memory_resource* memory_resource)
+      : params{memory_resource}, buffers{memory_resource} {}
 
+  std::pmr::vector<MYSQL_BIND> params;
+  std::pmr::vector<bind_result_buffer> buffers;
+
+  void resize(size_t no_of_columns) {
+    params.resize(no_of_columns, MYSQL_BIND{});
+    while (buffers.size() < no_of_columns) {
+      buffers.emplace_back(buffers.get_allocator().resource());
+    }
+  }
+};
+}  // namespace detail
+
+class bind_result_t {
   std::shared_ptr<MYSQL_STMT> _mysql_stmt;
-  std::vector<MYSQL_BIND> _result_params;
-  std::vector<bind_result_buffer> _result_buffers;
+  std::shared_ptr<detail::bind_result_buffers_t> _buffers;
   const connection_config* _config;
   void* _result_row_address{nullptr};
   bool _require_bind = true;
@@ -63,14 +87,10 @@ class bind_result_t {
  public:
   bind_result_t() = default;
   bind_result_t(const std::shared_ptr<MYSQL_STMT>& mysql_stmt,
-                size_t no_of_columns,
+                std::shared_ptr<detail::bind_result_buffers_t> buffers,
                 const connection_config* config)
       : _mysql_stmt{mysql_stmt},
-        _result_params(no_of_columns,
-                       MYSQL_BIND{}),  // ()-init for correct constructor
-        _result_buffers(
-            no_of_columns,
-            bind_result_buffer{}),  // ()-init for correct constructor
+        _buffers{std::move(buffers)},
         _config{config} {
     if constexpr (debug_enabled) {
       if (_mysql_stmt) {
@@ -128,10 +148,10 @@ class bind_result_t {
   bool _invalid() const { return !_mysql_stmt; }
 
   void bind_bool(size_t field_index) {
-    auto& buffer{_result_buffers[field_index]};
+    auto& buffer{_buffers->buffers[field_index]};
     new (&buffer.bool_) bool{};
 
-    MYSQL_BIND& param{_result_params[field_index]};
+    MYSQL_BIND& param{_buffers->params[field_index]};
     param.buffer_type = MYSQL_TYPE_TINY;
     param.buffer = &buffer.bool_;
     param.buffer_length = sizeof(buffer.bool_);
@@ -142,10 +162,10 @@ class bind_result_t {
   }
 
   void bind_int64(size_t field_index) {
-    auto& buffer{_result_buffers[field_index]};
+    auto& buffer{_buffers->buffers[field_index]};
     new (&buffer.int64_) int64_t{};
 
-    MYSQL_BIND& param{_result_params[field_index]};
+    MYSQL_BIND& param{_buffers->params[field_index]};
     param.buffer_type = MYSQL_TYPE_LONGLONG;
     param.buffer = &buffer.int64_;
     param.buffer_length = sizeof(buffer.int64_);
@@ -156,10 +176,10 @@ class bind_result_t {
   }
 
   void bind_uint64(size_t field_index) {
-    auto& buffer{_result_buffers[field_index]};
+    auto& buffer{_buffers->buffers[field_index]};
     new (&buffer.uint64_) uint64_t{};
 
-    MYSQL_BIND& param{_result_params[field_index]};
+    MYSQL_BIND& param{_buffers->params[field_index]};
     param.buffer_type = MYSQL_TYPE_LONGLONG;
     param.buffer = &buffer.uint64_;
     param.buffer_length = sizeof(buffer.uint64_);
@@ -170,10 +190,10 @@ class bind_result_t {
   }
 
   void bind_double(size_t field_index) {
-    auto& buffer{_result_buffers[field_index]};
+    auto& buffer{_buffers->buffers[field_index]};
     new (&buffer.double_) double{};
 
-    MYSQL_BIND& param{_result_params[field_index]};
+    MYSQL_BIND& param{_buffers->params[field_index]};
     param.buffer_type = MYSQL_TYPE_DOUBLE;
     param.buffer = &buffer.double_;
     param.buffer_length = sizeof(buffer.double_);
@@ -184,9 +204,9 @@ class bind_result_t {
   }
 
   void bind_string(size_t field_index) {
-    auto& buffer{_result_buffers[field_index]};
+    auto& buffer{_buffers->buffers[field_index]};
 
-    MYSQL_BIND& param{_result_params[field_index]};
+    MYSQL_BIND& param{_buffers->params[field_index]};
     param.buffer_type = MYSQL_TYPE_STRING;
     param.buffer = buffer.var_buffer.data();
     param.buffer_length = buffer.var_buffer.size();
@@ -197,9 +217,9 @@ class bind_result_t {
   }
 
   void bind_blob(size_t field_index) {
-    auto& buffer{_result_buffers[field_index]};
+    auto& buffer{_buffers->buffers[field_index]};
 
-    MYSQL_BIND& param{_result_params[field_index]};
+    MYSQL_BIND& param{_buffers->params[field_index]};
     param.buffer_type = MYSQL_TYPE_BLOB;
     param.buffer = buffer.var_buffer.data();
     param.buffer_length = buffer.var_buffer.size();
@@ -210,10 +230,10 @@ class bind_result_t {
   }
 
   void bind_chrono_field(size_t field_index, enum_field_types buffer_type) {
-    auto& buffer{_result_buffers[field_index]};
+    auto& buffer{_buffers->buffers[field_index]};
     new (&buffer.mysql_time_) MYSQL_TIME{};
 
-    MYSQL_BIND& param{_result_params[field_index]};
+    MYSQL_BIND& param{_buffers->params[field_index]};
     param.buffer_type = buffer_type;
     param.buffer = &buffer.mysql_time_;
     param.buffer_length = sizeof(buffer.mysql_time_);
@@ -237,22 +257,22 @@ class bind_result_t {
 
   auto& debug() const { return _config->debug; }
   bool get_is_null(size_t field_index) const {
-    return _result_buffers[field_index].is_null;
+    return _buffers->buffers[field_index].is_null;
   }
   auto get_bool(size_t field_index) const {
-    return _result_buffers[field_index].bool_;
+    return _buffers->buffers[field_index].bool_;
   }
   auto get_uint64(size_t field_index) const {
-    return _result_buffers[field_index].uint64_;
+    return _buffers->buffers[field_index].uint64_;
   }
   auto get_int64(size_t field_index) const {
-    return _result_buffers[field_index].int64_;
+    return _buffers->buffers[field_index].int64_;
   }
   auto get_double(size_t field_index) const {
-    return _result_buffers[field_index].double_;
+    return _buffers->buffers[field_index].double_;
   }
   auto get_time(size_t field_index) const {
-    return _result_buffers[field_index].mysql_time_;
+    return _buffers->buffers[field_index].mysql_time_;
   }
   void refetch_if_required(size_t field_index) {
     if constexpr (debug_enabled) {
@@ -260,8 +280,8 @@ class bind_result_t {
                            "MySQL debug: Checking result size at index: {}",
                            field_index);
     }
-    auto& buffer = _result_buffers[field_index];
-    auto& parameters = _result_params[field_index];
+    auto& buffer = _buffers->buffers[field_index];
+    auto& parameters = _buffers->params[field_index];
     if (*parameters.length > parameters.buffer_length) {
       if constexpr (debug_enabled) {
         _config->debug.log(log_category::result,
@@ -282,11 +302,11 @@ class bind_result_t {
     }
   }
   const char* get_data(size_t field_index) const {
-    return _result_buffers[field_index].var_buffer.data();
+    return _buffers->buffers[field_index].var_buffer.data();
   }
 
   auto get_length(size_t field_index) const {
-    return *_result_params[field_index].length;
+    return *_buffers->params[field_index].length;
   }
 
  private:
@@ -298,7 +318,7 @@ class bind_result_t {
     }
 
     if (mysql_stmt_bind_result(_mysql_stmt.get(),
-                               _result_params.data())) {
+                               _buffers->params.data())) {
       throw exception{mysql_stmt_error(_mysql_stmt.get()),
                       mysql_stmt_errno(_mysql_stmt.get())};
     }
@@ -320,8 +340,8 @@ class bind_result_t {
       case MYSQL_NO_DATA:
         return false;
       default:
-        throw exception{mysql_stmt_error(_mysql_stmt.get()),
-                        mysql_stmt_errno(_mysql_stmt.get())};
+        detail::throw_statement_exception(mysql_stmt_error(_mysql_stmt.get()),
+                                          mysql_stmt_errno(_mysql_stmt.get()));
     }
   }
 };
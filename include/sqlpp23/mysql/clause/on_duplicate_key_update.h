@@ -0,0 +1,239 @@
+#pragma once
+
+/*
+Copyright (c) 2025, Roland Bock
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+   list of conditions and the following disclaimer.
+
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation and/or
+   other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <sqlpp23/core/basic/table_as.h>
+#include <sqlpp23/core/clause/simple_column.h>
+#include <sqlpp23/core/concepts.h>
+#include <sqlpp23/core/detail/type_set.h>
+#include <sqlpp23/core/noop.h>
+#include <sqlpp23/core/query/statement.h>
+#include <sqlpp23/core/reader.h>
+#include <sqlpp23/core/tuple_to_sql_string.h>
+#include <sqlpp23/core/type_traits.h>
+
+namespace sqlpp {
+namespace mysql {
+// VALUES(column) refers to the value that would have been inserted into
+// `column` by the INSERT part of the statement.
+//
+// Note: Deprecated since MySQL 8.0.20 in favor of row aliases, but still the
+// only option in MariaDB.
+template <typename Column>
+struct insert_value_ref_t {
+  insert_value_ref_t(Column column) : _column(std::move(column)) {}
+  insert_value_ref_t(const insert_value_ref_t&) = default;
+  insert_value_ref_t(insert_value_ref_t&&) = default;
+  insert_value_ref_t& operator=(const insert_value_ref_t&) = default;
+  insert_value_ref_t& operator=(insert_value_ref_t&&) = default;
+  ~insert_value_ref_t() = default;
+
+ private:
+  friend ::sqlpp::reader_t;
+  Column _column;
+};
+
+template <typename Column>
+  requires(is_column_v<Column>)
+auto values(Column column) -> insert_value_ref_t<Column> {
+  return {std::move(column)};
+}
+
+template <typename Context, typename Column>
+auto to_sql_string(Context& context, const insert_value_ref_t<Column>& t)
+    -> std::string {
+  return "VALUES(" + to_sql_string(context, simple_column(read.column(t))) +
+         ")";
+}
+}  // namespace mysql
+
+template <typename Column>
+struct data_type_of<mysql::insert_value_ref_t<Column>>
+    : public data_type_of<Column> {};
+
+template <typename Column>
+struct nodes_of<mysql::insert_value_ref_t<Column>> {
+  using type = detail::type_vector<Column>;
+};
+
+namespace mysql {
+class assert_no_unknown_tables_in_on_duplicate_key_update_t
+    : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>,
+                  "at least one assignment in on_duplicate_key_update() "
+                  "requires a table which is otherwise not known in the "
+                  "statement");
+  }
+};
+
+class assert_no_unknown_static_tables_in_on_duplicate_key_update_t
+    : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>,
+                  "at least one assignment in on_duplicate_key_update() "
+                  "statically requires a table which is only known "
+                  "dynamically in the statement");
+  }
+};
+
+// ON DUPLICATE KEY UPDATE ...
+//
+// With a RowAlias other than noop, the clause is preceded by
+// `AS row_alias`, and the columns of the row alias refer to the values that
+// would have been inserted (MySQL 8.0.19 or later).
+template <typename RowAlias, typename... Assignments>
+struct on_duplicate_key_update_t {
+  on_duplicate_key_update_t(std::tuple<Assignments...> assignments)
+      : _assignments(std::move(assignments)) {}
+  on_duplicate_key_update_t(const on_duplicate_key_update_t&) = default;
+  on_duplicate_key_update_t(on_duplicate_key_update_t&&) = default;
+  on_duplicate_key_update_t& operator=(const on_duplicate_key_update_t&) =
+      default;
+  on_duplicate_key_update_t& operator=(on_duplicate_key_update_t&&) = default;
+  ~on_duplicate_key_update_t() = default;
+
+ private:
+  friend ::sqlpp::reader_t;
+  std::tuple<Assignments...> _assignments;
+};
+
+template <typename Context, typename RowAlias, typename... Assignments>
+auto to_sql_string(
+    Context& context,
+    const on_duplicate_key_update_t<RowAlias, Assignments...>& t)
+    -> std::string {
+  auto ret_val = std::string{};
+  if constexpr (not std::is_same_v<RowAlias, noop>) {
+    ret_val += " AS " + name_to_sql_string(context, name_tag_of_t<RowAlias>{});
+  }
+  return ret_val + " ON DUPLICATE KEY UPDATE " +
+         tuple_to_sql_string(context, read.assignments(t),
+                             tuple_operand_no_dynamic{", "});
+}
+
+template <typename T>
+struct is_row_alias : public std::false_type {};
+
+template <typename TableSpec, typename NameTag>
+struct is_row_alias<table_as_t<TableSpec, NameTag>> : public std::true_type {};
+
+struct no_on_duplicate_key_update_t {
+  template <typename Statement, DynamicAssignment... Assignments>
+    requires(sizeof...(Assignments) > 0 and
+             not sqlpp::detail::has_duplicates<
+                 typename lhs<Assignments>::type...>::value and
+             sqlpp::detail::make_joined_set_t<required_tables_of_t<
+                 typename lhs<Assignments>::type>...>::size() == 1)
+  auto on_duplicate_key_update(this Statement&& self,
+                               Assignments... assignments) {
+    return new_statement<no_on_duplicate_key_update_t>(
+        std::forward<Statement>(self),
+        on_duplicate_key_update_t<noop, Assignments...>{
+            std::make_tuple(std::move(assignments)...)});
+  }
+
+  // Use `table.as(name)` as row alias.
+  template <typename Statement,
+            typename RowAlias,
+            DynamicAssignment... Assignments>
+    requires(is_row_alias<RowAlias>::value and sizeof...(Assignments) > 0 and
+             not sqlpp::detail::has_duplicates<
+                 typename lhs<Assignments>::type...>::value and
+             sqlpp::detail::make_joined_set_t<required_tables_of_t<
+                 typename lhs<Assignments>::type>...>::size() == 1)
+  auto on_duplicate_key_update(this Statement&& self,
+                               RowAlias /* row_alias */,
+                               Assignments... assignments) {
+    return new_statement<no_on_duplicate_key_update_t>(
+        std::forward<Statement>(self),
+        on_duplicate_key_update_t<RowAlias, Assignments...>{
+            std::make_tuple(std::move(assignments)...)});
+  }
+};
+
+template <typename Context>
+auto to_sql_string(Context&, const no_on_duplicate_key_update_t&)
+    -> std::string {
+  return "";
+}
+}  // namespace mysql
+
+template <typename RowAlias, typename... Assignments>
+struct is_clause<mysql::on_duplicate_key_update_t<RowAlias, Assignments...>>
+    : public std::true_type {};
+
+template <typename RowAlias, typename... Assignments>
+struct nodes_of<mysql::on_duplicate_key_update_t<RowAlias, Assignments...>> {
+  using type = detail::type_vector<Assignments...>;
+};
+
+// The row alias is a table that is known within the clause, only.
+template <typename RowAlias, typename... Assignments>
+struct provided_tables_of<
+    mysql::on_duplicate_key_update_t<RowAlias, Assignments...>>
+    : public provided_tables_of<RowAlias> {};
+
+template <typename Statement, typename RowAlias, typename... Assignments>
+struct consistency_check<
+    Statement,
+    mysql::on_duplicate_key_update_t<RowAlias, Assignments...>> {
+  using type = consistent_t;
+  constexpr auto operator()() {
+    return type{};
+  }
+};
+
+template <typename Statement, typename RowAlias, typename... Assignments>
+struct prepare_check<
+    Statement,
+    mysql::on_duplicate_key_update_t<RowAlias, Assignments...>> {
+  using _clause_t = mysql::on_duplicate_key_update_t<RowAlias, Assignments...>;
+  using type = static_combined_check_t<
+      static_check_t<
+          Statement::template _no_unknown_tables<_clause_t>,
+          mysql::assert_no_unknown_tables_in_on_duplicate_key_update_t>,
+      static_check_t<
+          Statement::template _no_unknown_static_tables<_clause_t>,
+          mysql::assert_no_unknown_static_tables_in_on_duplicate_key_update_t>>;
+  constexpr auto operator()() {
+    return type{};
+  }
+};
+
+template <typename Statement>
+struct consistency_check<Statement, mysql::no_on_duplicate_key_update_t> {
+  using type = consistent_t;
+  constexpr auto operator()() {
+    return type{};
+  }
+};
+}  // namespace sqlpp
@@ -78,4 +78,40 @@ struct compatibility_check<mysql::context_t, sort_order_expression<L, sort_order
   using type = mysql::assert_no_nulls_first_last;
 };
 
+namespace mysql {
+class assert_no_for_no_key_update : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>, "MySQL: No support for FOR NO KEY UPDATE");
+  }
+};
+}  // namespace mysql
+
+template <typename Wait>
+struct compatibility_check<mysql::context_t,
+                           locking_t<lock_for_no_key_update_t, Wait>> {
+  using type = mysql::assert_no_for_no_key_update;
+};
+
+namespace mysql {
+class assert_no_indexed_by : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>,
+                  "MySQL: No support for INDEXED BY or NOT INDEXED, use "
+                  "use_index, force_index or ignore_index instead");
+  }
+};
+}  // namespace mysql
+
+template <typename Table, typename Hint, typename... Indexes>
+  requires(std::is_same_v<Hint, indexed_by_t> or
+           std::is_same_v<Hint, not_indexed_t>)
+struct compatibility_check<mysql::context_t,
+                           index_hint_t<Table, Hint, Indexes...>> {
+  using type = mysql::assert_no_indexed_by;
+};
+
 }  // namespace sqlpp
@@ -28,10 +28,17 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
 #include <string>
 
 #include <sqlpp23/core/database/connection.h>
+#include <sqlpp23/core/database/execute_many.h>
+#include <sqlpp23/core/database/serialization_cache.h>
+#include <sqlpp23/core/query/lazy_row.h>
+#include <sqlpp23/core/query/select_into.h>
 #include <sqlpp23/core/query/statement.h>
 #include <sqlpp23/core/query/statement_handler.h>
 #include <sqlpp23/core/to_sql_string.h>
@@ -76,8 +83,8 @@ inline void execute_statement(connection_handle& handle,
   }
 
   if (mysql_query(handle.native_handle(), statement.data())) {
-    throw exception{mysql_error(handle.native_handle()),
-                    mysql_errno(handle.native_handle())};
+    throw_statement_exception(mysql_error(handle.native_handle()),
+                              mysql_errno(handle.native_handle()));
   }
 }
 
@@ -97,13 +104,59 @@ inline void execute_prepared_statement(
   }
 
   if (mysql_stmt_execute(prepared_statement.native_handle().get())) {
-    throw exception{mysql_stmt_error(prepared_statement.native_handle().get()),
-                    mysql_stmt_errno(prepared_statement.native_handle().get())};
+    throw_statement_exception(
+        mysql_stmt_error(prepared_statement.native_handle().get()),
+        mysql_stmt_errno(prepared_statement.native_handle().get()));
   }
 }
 
 }  // namespace detail
 
+// Cancels the statement that a connection is currently executing by sending
+// KILL QUERY via a separate connection. Can be used from any thread, e.g. by a
+// watchdog. Does nothing once the connection is closed, moved or returned to
+// its pool.
+class cancel_handle {
+ public:
+  explicit cancel_handle(std::weak_ptr<detail::cancel_state> state)
+      : _state{std::move(state)} {}
+
+  // The current statement throws timeout_exception. Does nothing if no
+  // statement is running. The first call opens the separate connection, which
+  // is then reused. Throws if connecting or sending KILL QUERY fails.
+  void cancel() const {
+    const auto state = _state.lock();
+    if (not state) {
+      return;
+    }
+    const auto lock = std::lock_guard{state->mutex};
+    if (state->connection_id == 0) {
+      return;
+    }
+    detail::thread_init();
+    if (not state->killer) {
+      auto killer = decltype(state->killer){mysql_init(nullptr), mysql_close};
+      if (not killer) {
+        throw sqlpp::exception{"MySQL: could not init mysql data structure"};
+      }
+      detail::connect(killer.get(), *state->config);
+      state->killer = std::move(killer);
+    }
+    const auto statement = "KILL QUERY " + std::to_string(state->connection_id);
+    if (mysql_real_query(state->killer.get(), statement.data(),
+                         statement.size())) {
+      const auto error = exception{mysql_error(state->killer.get()),
+                                   mysql_errno(state->killer.get())};
+      // Reconnect next time.
+      state->killer.reset();
+      throw error;
+    }
+  }
+
+ private:
+  std::weak_ptr<detail::cancel_state> _state;
+};
+
 struct scoped_library_initializer_t {
   scoped_library_initializer_t(int argc = 0,
                                char** argv = nullptr,
@@ -137,6 +190,7 @@ class connection_base : public sqlpp::connection {
   using _config_t = connection_config;
   using _config_ptr_t = std::shared_ptr<const _config_t>;
   using _handle_t = detail::connection_handle;
+  using _context_t = context_t;
 
   using _prepared_statement_t = ::sqlpp::mysql::prepared_statement_t;
 
@@ -144,6 +198,8 @@ class connection_base : public sqlpp::connection {
   friend sqlpp::statement_handler_t;
 
   bool _transaction_active{false};
+  sqlpp::detail::prepared_sql_t _prepared_sql;
+  std::pmr::memory_resource* _memory_resource{std::pmr::get_default_resource()};
 
   // direct execution
 
@@ -158,8 +214,8 @@ class connection_base : public sqlpp::connection {
         mysql_store_result(_handle.native_handle()), mysql_free_result};
 
     if (!result) {
-    throw exception{mysql_error(_handle.native_handle()),
-                    mysql_errno(_handle.native_handle())};
+      detail::throw_statement_exception(mysql_error(_handle.native_handle()),
+                                        mysql_errno(_handle.native_handle()));
     }
 
     return {std::move(result), _handle.config.get()};
@@ -193,14 +249,16 @@ class connection_base : public sqlpp::connection {
     }
 
     return prepared_statement_t(_handle.native_handle(), statement,
-                                no_of_parameters, _handle.config.get());
+                                no_of_parameters, _handle.config.get(),
+                                _memory_resource);
   }
 
   bind_result_t run_prepared_select_impl(
       prepared_statement_t& prepared_statement,
       size_t no_of_columns) {
     detail::execute_prepared_statement(prepared_statement);
-    return bind_result_t{prepared_statement.native_handle(), no_of_columns,
+    return bind_result_t{prepared_statement.native_handle(),
+                         prepared_statement.result_buffers(no_of_columns),
                          _handle.config.get()};
   }
 
@@ -238,7 +296,7 @@ class connection_base : public sqlpp::connection {
   template <typename Execute>
   _prepared_statement_t _prepare_execute(const Execute& u) {
     context_t context(this);
-    const auto query = to_sql_string(context, u);
+    const auto query = _prepared_sql(context, u);
     return prepare_impl(query, parameters_of_t<std::decay_t<Execute>>::size());
   }
 
@@ -259,7 +317,7 @@ class connection_base : public sqlpp::connection {
   template <typename Select>
   _prepared_statement_t _prepare_select(const Select& s) {
     context_t context(this);
-    const auto query = to_sql_string(context, s);
+    const auto query = _prepared_sql(context, s);
     return prepare_impl(query, parameters_of_t<std::decay_t<Select>>::size());
   }
 
@@ -282,7 +340,7 @@ class connection_base : public sqlpp::connection {
   template <typename Insert>
   _prepared_statement_t _prepare_insert(const Insert& i) {
     context_t context(this);
-    const auto query = to_sql_string(context, i);
+    const auto query = _prepared_sql(context, i);
     return prepare_impl(query, parameters_of_t<std::decay_t<Insert>>::size());
   }
 
@@ -304,7 +362,7 @@ class connection_base : public sqlpp::connection {
   template <typename Update>
   _prepared_statement_t _prepare_update(const Update& u) {
     context_t context(this);
-    const auto query = to_sql_string(context, u);
+    const auto query = _prepared_sql(context, u);
     return prepare_impl(query, parameters_of_t<std::decay_t<Update>>::size());
   }
 
@@ -326,7 +384,7 @@ class connection_base : public sqlpp::connection {
   template <typename Delete>
   _prepared_statement_t _prepare_delete_from(const Delete& r) {
     context_t context(this);
-    const auto query = to_sql_string(context, r);
+    const auto query = _prepared_sql(context, r);
     return prepare_impl(query, parameters_of_t<std::decay_t<Delete>>::size());
   }
 
@@ -372,6 +430,85 @@ class connection_base : public sqlpp::connection {
     return sqlpp::statement_handler_t{}.prepare(t, *this);
   }
 
+  //! Like prepare(t), but the serialized statement is memoized in `cache`,
+  //! keyed by the statement type and its sqlpp::dynamic_shape(). Values other
+  //! than parameters (e.g. `tab.id == 5`) are rejected at compile time.
+  template <typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto prepare(const T& t, sqlpp::serialization_cache& cache) {
+    sqlpp::serialization_cache_check_t<T>{}.verify();
+    return _prepared_sql.with_cache(cache, [&] { return prepare(t); });
+  }
+
+  //! Executes a prepared insert, update, delete or execute statement once per
+  //! element of `rows` (tuples of parameter values) within a transaction.
+  //! Returns the total number of affected rows.
+  template <typename PreparedStatement, typename Range>
+    requires(sqlpp::is_prepared_statement_v<PreparedStatement>)
+  size_t execute_many(PreparedStatement& prepared, const Range& rows) {
+    return sqlpp::detail::execute_many(*this, prepared, rows);
+  }
+
+  //! Like operator() for select statements, but reads each row directly into
+  //! a Struct, matching members and result columns by name. Requires C++26
+  //! reflection, see docs/select.md.
+  template <typename Struct, typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto select_into(const T& t) {
+    sqlpp::check_run_consistency(t).verify();
+    sqlpp::check_compatibility<context_t>(t).verify();
+    return sqlpp::detail::select_into<Struct>(t, *this);
+  }
+
+  template <typename Struct, typename T>
+    requires(sqlpp::is_prepared_statement_v<std::decay_t<T>>)
+  auto select_into(T&& t) {
+    return sqlpp::detail::select_into<Struct>(std::forward<T>(t), *this);
+  }
+
+  //! Like operator() for select statements, but reads fields only when they
+  //! are accessed, e.g. via `row.id()`. See docs/select.md.
+  template <typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto select_lazy(const T& t) {
+    sqlpp::check_run_consistency(t).verify();
+    sqlpp::check_compatibility<context_t>(t).verify();
+    return sqlpp::detail::select_lazy(t, *this);
+  }
+
+  template <typename T>
+    requires(sqlpp::is_prepared_statement_v<std::decay_t<T>>)
+  auto select_lazy(T&& t) {
+    return sqlpp::detail::select_lazy(std::forward<T>(t), *this);
+  }
+
+  //! Memory resource for the buffers of prepared statements and results
+  //! created by this connection, e.g. a per-request arena. These must not
+  //! outlive the resource. nullptr selects the default resource.
+  void set_memory_resource(std::pmr::memory_resource* resource) {
+    _memory_resource =
+        resource ? resource : std::pmr::get_default_resource();
+  }
+
+  std::pmr::memory_resource* get_memory_resource() const {
+    return _memory_resource;
+  }
+
+  //! Selects running longer than `timeout` are aborted by the server and throw
+  //! timeout_exception. 0 disables the timeout. Applies to the session, i.e.
+  //! pooled connections keep it. Note that MySQL only limits the execution
+  //! time of read-only selects.
+  void set_statement_timeout(std::chrono::milliseconds timeout) {
+    _handle.set_statement_timeout(timeout);
+  }
+
+  //! Returns a handle that can cancel statements of this connection from
+  //! other threads.
+  cancel_handle get_cancel_handle() const {
+    return cancel_handle{
+        _handle.cancel_state.get(_handle.native_handle(), _handle.config)};
+  }
+
   //! start transaction
   void start_transaction() {
     execute_statement(_handle, "START TRANSACTION");
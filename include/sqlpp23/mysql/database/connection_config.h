@@ -27,6 +27,7 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
 #include <string>
 
 #include <sqlpp23/core/debug_logger.h>
@@ -50,6 +51,10 @@ struct connection_config {
   std::string ssl_capath;
   std::string ssl_cipher;
   unsigned int read_timeout{0};
+  // Selects running longer than this are aborted by the server and throw
+  // timeout_exception. 0 disables the timeout, see
+  // connection_base::set_statement_timeout().
+  std::chrono::milliseconds statement_timeout{0};  // not compared
   debug_logger debug;  // not compared
 
   bool operator==(const connection_config& other) const {
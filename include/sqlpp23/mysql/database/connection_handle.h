@@ -28,7 +28,12 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include <sqlpp23/mysql/database/connection_config.h>
 #include <sqlpp23/mysql/database/exception.h>
@@ -90,9 +95,61 @@ inline void connect(MYSQL* mysql, const connection_config& config) {
   }
 }
 
+// Shared by a connection handle and its cancel handles.
+struct cancel_state {
+  cancel_state(unsigned long id, std::shared_ptr<const connection_config> conf)
+      : connection_id{id}, config{std::move(conf)} {}
+
+  std::mutex mutex;
+  // Zero once the connection handle is closed or moved, since the server
+  // might reuse the id for another connection.
+  unsigned long connection_id;
+  std::shared_ptr<const connection_config> config;
+  // Opened by the first cancellation and reused afterwards.
+  std::unique_ptr<MYSQL, void (*)(MYSQL*)> killer{nullptr, mysql_close};
+};
+
+// Detaches the cancel handles of a connection handle when the latter is
+// destroyed or moved (e.g. returned to a connection pool).
+class cancel_state_owner {
+ public:
+  cancel_state_owner() = default;
+  cancel_state_owner(const cancel_state_owner&) = delete;
+  cancel_state_owner(cancel_state_owner&& other) noexcept { other.reset(); }
+  cancel_state_owner& operator=(const cancel_state_owner&) = delete;
+  cancel_state_owner& operator=(cancel_state_owner&& other) noexcept {
+    reset();
+    other.reset();
+    return *this;
+  }
+  ~cancel_state_owner() { reset(); }
+
+  std::weak_ptr<cancel_state> get(
+      MYSQL* mysql,
+      const std::shared_ptr<const connection_config>& config) {
+    if (not _state) {
+      _state = std::make_shared<cancel_state>(mysql_thread_id(mysql), config);
+    }
+    return _state;
+  }
+
+  // Waits for a cancellation in progress.
+  void reset() noexcept {
+    if (_state) {
+      const auto lock = std::lock_guard{_state->mutex};
+      _state->connection_id = 0;
+    }
+    _state.reset();
+  }
+
+ private:
+  std::shared_ptr<cancel_state> _state;
+};
+
 struct connection_handle {
   std::shared_ptr<const connection_config> config;
   std::unique_ptr<MYSQL, void (*)(MYSQL*)> mysql;
+  mutable cancel_state_owner cancel_state;
 
   connection_handle() : config{}, mysql{nullptr, mysql_close} {}
 
@@ -103,6 +160,10 @@ struct connection_handle {
     }
 
     connect(native_handle(), *config);
+
+    if (config->statement_timeout.count() > 0) {
+      set_statement_timeout(config->statement_timeout);
+    }
   }
 
   connection_handle(const connection_handle&) = delete;
@@ -112,6 +173,17 @@ struct connection_handle {
 
   MYSQL* native_handle() const { return mysql.get(); }
 
+  void set_statement_timeout(std::chrono::milliseconds timeout) {
+    const auto statement =
+        "SET SESSION max_execution_time = " +
+        std::to_string(std::max<int64_t>(timeout.count(), 0));
+    if (mysql_real_query(native_handle(), statement.data(),
+                         statement.size())) {
+      throw exception{mysql_error(native_handle()),
+                      mysql_errno(native_handle())};
+    }
+  }
+
   bool is_connected() const {
     // The connection is established in the constructor and the MySQL client
     // library doesn't seem to have a way to check passively if the connection
@@ -45,4 +45,25 @@ class exception : public sqlpp::exception {
   unsigned int error_code() const { return _error_code; }
 };
 
+// Thrown when the server aborted a statement because it exceeded
+// connection_config::statement_timeout (ER_QUERY_TIMEOUT) or because it was
+// canceled via a cancel_handle (ER_QUERY_INTERRUPTED).
+class timeout_exception : public exception {
+ public:
+  using exception::exception;
+};
+
+namespace detail {
+inline constexpr unsigned int er_query_interrupted = 1317;
+inline constexpr unsigned int er_query_timeout = 3024;
+
+[[noreturn]] inline void throw_statement_exception(const char* what_arg,
+                                                   unsigned int error_code) {
+  if (error_code == er_query_interrupted or error_code == er_query_timeout) {
+    throw timeout_exception{what_arg, error_code};
+  }
+  throw exception{what_arg, error_code};
+}
+}  // namespace detail
+
 }  // namespace sqlpp
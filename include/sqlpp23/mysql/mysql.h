@@ -28,6 +28,7 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sqlpp23/mysql/clause/insert.h>
 #include <sqlpp23/mysql/text_result.h>
 #include <sqlpp23/mysql/database/connection.h>
 #include <sqlpp23/mysql/database/connection_pool.h>
@@ -27,7 +27,12 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
 #include <sqlpp23/core/chrono.h>
+#include <sqlpp23/mysql/bind_result.h>
 #include <sqlpp23/mysql/database/connection_config.h>
 #include <sqlpp23/mysql/database/exception.h>
 #include <sqlpp23/mysql/sqlpp_mysql.h>
@@ -56,10 +61,11 @@ class prepared_statement_t {
   friend ::sqlpp::mysql::connection_base;
 
   std::shared_ptr<MYSQL_STMT> mysql_stmt;
-  std::vector<MYSQL_BIND> stmt_params;
-  std::vector<MYSQL_TIME> stmt_date_time_param_buffer;
-  std::vector<detail::wrapped_bool>
+  std::pmr::vector<MYSQL_BIND> stmt_params;
+  std::pmr::vector<MYSQL_TIME> stmt_date_time_param_buffer;
+  std::pmr::vector<detail::wrapped_bool>
       stmt_param_is_null;  // my_bool is bool after 8.0, and vector<bool> is bad
+  std::shared_ptr<detail::bind_result_buffers_t> _result_buffers;
   const connection_config* _config;
 
  public:
@@ -67,20 +73,33 @@ class prepared_statement_t {
   prepared_statement_t(MYSQL* connection,
                        const std::string& statement,
                        size_t no_of_parameters,
-                       const connection_config* config)
+                       const connection_config* config,
+                       std::pmr::memory_resource* memory_resource =
+                           std::pmr::get_default_resource())
       : mysql_stmt{mysql_stmt_init(connection), mysql_stmt_close},
         stmt_params(no_of_parameters,
-                    MYSQL_BIND{}),  // ()-init for correct constructor
+                    MYSQL_BIND{},
+                    memory_resource),  // ()-init for correct constructor
         stmt_date_time_param_buffer(
             no_of_parameters,
-            MYSQL_TIME{}),  // ()-init for correct constructor
+            MYSQL_TIME{},
+            memory_resource),  // ()-init for correct constructor
         stmt_param_is_null(no_of_parameters,
-                           false),  // ()-init for correct constructor
+                           false,
+                           memory_resource),  // ()-init for correct constructor
         _config{config} {
     if (mysql_stmt_prepare(native_handle().get(), statement.data(),
                            statement.size())) {
       throw exception{mysql_error(connection), mysql_errno(connection)};
     }
+    // Array parameters occupy more than one placeholder.
+    const auto no_of_placeholders =
+        static_cast<size_t>(mysql_stmt_param_count(native_handle().get()));
+    if (no_of_placeholders > no_of_parameters) {
+      stmt_params.resize(no_of_placeholders, MYSQL_BIND{});
+      stmt_date_time_param_buffer.resize(no_of_placeholders, MYSQL_TIME{});
+      stmt_param_is_null.resize(no_of_placeholders, false);
+    }
     if constexpr (debug_enabled) {
       debug().log(log_category::statement,
                   "Constructed prepared_statement, using handle at {}",
@@ -95,7 +114,22 @@ class prepared_statement_t {
   ~prepared_statement_t() = default;
 
   std::shared_ptr<MYSQL_STMT> native_handle() const { return mysql_stmt; }
-  std::vector<MYSQL_BIND> parameters() { return stmt_params; }
+  std::pmr::vector<MYSQL_BIND>& parameters() { return stmt_params; }
+
+  // Result buffers are shared with bind_result_t and re-used by subsequent
+  // executions.
+  const std::shared_ptr<detail::bind_result_buffers_t>& result_buffers(
+      size_t no_of_columns) {
+    if (not _result_buffers) {
+      // Buffers and control block are allocated from the statement's memory
+      // resource.
+      auto* const memory_resource = stmt_params.get_allocator().resource();
+      _result_buffers = std::allocate_shared<detail::bind_result_buffers_t>(
+          std::pmr::polymorphic_allocator<>{memory_resource}, memory_resource);
+    }
+    _result_buffers->resize(no_of_columns);
+    return _result_buffers;
+  }
 
   const debug_logger& debug() { return _config->debug; }
 
@@ -35,6 +35,7 @@
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/database/exception.h>
 #include <sqlpp23/core/detail/parse_date_time.h>
+#include <sqlpp23/core/detail/parse_number.h>
 #include <sqlpp23/core/query/result_row.h>
 #include <sqlpp23/mysql/text_result_row.h>
 #include <sqlpp23/mysql/database/connection_config.h>
@@ -85,6 +86,10 @@ class text_result_t {
   size_t get_field_length(size_t field_index) const {
     return _text_result_row.len[field_index];
   }
+  std::string_view get_field_text(size_t field_index) const {
+    return std::string_view(get_field_value(field_index),
+                            get_field_length(field_index));
+  }
 
   template <typename ResultRow>
   void next(ResultRow& result_row) {
@@ -129,15 +134,15 @@ class text_result_t {
   }
 
   inline void read_field(const text_result_t& result, size_t field_index, double& value) {
-    value = std::strtod(result.get_field_value(field_index), nullptr);
+    ::sqlpp::detail::parse_number(value, result.get_field_text(field_index));
   }
 
   inline void read_field(const text_result_t& result, size_t field_index, int64_t& value) {
-    value = std::strtoll(result.get_field_value(field_index), nullptr, 10);
+    ::sqlpp::detail::parse_number(value, result.get_field_text(field_index));
   }
 
   inline void read_field(const text_result_t& result, size_t field_index, uint64_t& value) {
-    value = std::strtoull(result.get_field_value(field_index), nullptr, 10);
+    ::sqlpp::detail::parse_number(value, result.get_field_text(field_index));
   }
 
   inline void read_field(const text_result_t& result, size_t field_index, std::span<const uint8_t>& value) {
@@ -157,7 +162,7 @@ class text_result_t {
                            "parsing date result at index: {}", field_index);
     }
 
-    const char* date_string = result.get_field_value(field_index);
+    auto date_string = result.get_field_text(field_index);
     if constexpr (debug_enabled) {
       result.debug().log(log_category::result, "date string: {}",
                            date_string);
@@ -169,7 +174,7 @@ class text_result_t {
       }
     }
 
-    if (*date_string) {
+    if (not date_string.empty()) {
       if constexpr (debug_enabled) {
         result.debug().log(log_category::result,
                            "trailing characters in date result: {}",
@@ -184,7 +189,7 @@ class text_result_t {
                            "parsing timestamp result at index: {}", field_index);
     }
 
-    const char* date_time_string = result.get_field_value(field_index);
+    auto date_time_string = result.get_field_text(field_index);
     if constexpr (debug_enabled) {
       result.debug().log(log_category::result, "date_time string: {}",
                            date_time_string);
@@ -196,7 +201,7 @@ class text_result_t {
       }
     }
 
-    if (*date_time_string) {
+    if (not date_time_string.empty()) {
       if constexpr (debug_enabled) {
         result.debug().log(log_category::result,
                            "trailing characters in date_time result: {}",
@@ -211,7 +216,7 @@ class text_result_t {
                            "parsing time of day result at index: {}", field_index);
     }
 
-    const char* time_string = result.get_field_value(field_index);
+    auto time_string = result.get_field_text(field_index);
     if constexpr (debug_enabled) {
       result.debug().log(log_category::result, "time of day string: {}",
                            time_string);
@@ -223,7 +228,7 @@ class text_result_t {
       }
     }
 
-    if (*time_string) {
+    if (not time_string.empty()) {
       if constexpr (debug_enabled) {
         result.debug().log(log_category::result,
                            "trailing characters in time result: {}",
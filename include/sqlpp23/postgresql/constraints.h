@@ -47,6 +47,22 @@ class assert_no_cast_bool_to_numeric : public wrapped_static_assert {
     static_assert(wrong<T...>, "Postgresql: No support for casting bool to numeric");
   }
 };
+
+class assert_no_index_hints : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>, "Postgresql: No support for index hints");
+  }
+};
+
+class assert_no_optimizer_hints : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>, "Postgresql: No support for optimizer hints");
+  }
+};
 }  // namespace postgresql
 
 template <typename Expression>
@@ -63,4 +79,15 @@ struct compatibility_check<postgresql::context_t, cast_t<bool, Type>> {
   using type = postgresql::assert_no_cast_bool_to_numeric;
 };
 
+template <typename Table, typename Hint, typename... Indexes>
+struct compatibility_check<postgresql::context_t,
+                           index_hint_t<Table, Hint, Indexes...>> {
+  using type = postgresql::assert_no_index_hints;
+};
+
+template <typename... Hints>
+struct compatibility_check<postgresql::context_t, optimizer_hints_t<Hints...>> {
+  using type = postgresql::assert_no_optimizer_hints;
+};
+
 }  // namespace sqlpp
@@ -28,13 +28,21 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <exception>
 #include <memory>
+#include <memory_resource>
 #include <sqlpp23/core/query/statement.h>
 #include <sqlpp23/core/type_traits.h>
 
 #include <sqlpp23/core/database/connection.h>
+#include <sqlpp23/core/database/serialization_cache.h>
 #include <sqlpp23/core/database/exception.h>
+#include <sqlpp23/core/database/execute_many.h>
 #include <sqlpp23/core/database/transaction.h>
+#include <sqlpp23/core/query/lazy_row.h>
+#include <sqlpp23/core/query/select_into.h>
 #include <sqlpp23/core/query/statement_constructor_arg.h>
 #include <sqlpp23/core/to_sql_string.h>
 #include <sqlpp23/postgresql/database/connection_config.h>
@@ -56,16 +64,39 @@ struct command_result {
 };
 
 namespace detail {
-inline prepared_statement_t prepare_statement(connection_handle& handle,
-                                              const std::string& stmt,
-                                              const size_t& param_count) {
+// Named statements are prepared on the server once, unnamed statements are
+// sent together with the parameters for each execution.
+enum class prepare_mode { named, unnamed };
+
+inline prepared_statement_t prepare_statement(
+    connection_handle& handle,
+    const std::string& stmt,
+    const size_t& param_count,
+    std::pmr::memory_resource* memory_resource) {
   if constexpr (debug_enabled) {
     handle.debug().log(log_category::statement, "preparing: {}", stmt);
   }
 
+  handle.deallocate_prepared_statements();
   return prepared_statement_t{handle.native_handle(), stmt,
                               handle.get_prepared_statement_name(), param_count,
-                              handle.config.get()};
+                              handle.config.get(),
+                              handle._pending_deallocations, memory_resource};
+}
+
+inline prepared_statement_t prepare_unnamed_statement(
+    connection_handle& handle,
+    const std::string& stmt,
+    const size_t& param_count,
+    std::pmr::memory_resource* memory_resource) {
+  if constexpr (debug_enabled) {
+    handle.debug().log(log_category::statement, "preparing unnamed: {}", stmt);
+  }
+
+  return prepared_statement_t{handle.native_handle(), stmt, std::string{},
+                              param_count, handle.config.get(),
+                              /*pending_deallocations*/ nullptr,
+                              memory_resource};
 }
 
 inline pg_result_t execute_prepared_statement(connection_handle& handle,
@@ -74,10 +105,111 @@ inline pg_result_t execute_prepared_statement(connection_handle& handle,
     handle.debug().log(log_category::statement,
                        "executing prepared statement: {}", prepared.name());
   }
+  handle.deallocate_prepared_statements();
   return prepared.execute();
 }
+
+#ifdef LIBPQ_HAS_PIPELINING
+// Statements sent in pipeline mode do not wait for the results of previous
+// statements. The results are collected by sync().
+class pipeline_t {
+ public:
+  explicit pipeline_t(connection_handle& handle) : _handle{handle} {
+    if (PQenterPipelineMode(_handle.native_handle()) != 1) {
+      throw sqlpp::exception{PQerrorMessage(_handle.native_handle())};
+    }
+  }
+  pipeline_t(const pipeline_t&) = delete;
+  pipeline_t(pipeline_t&&) = delete;
+  pipeline_t& operator=(const pipeline_t&) = delete;
+  pipeline_t& operator=(pipeline_t&&) = delete;
+  ~pipeline_t() {
+    // Pending results have to be consumed before leaving pipeline mode, e.g.
+    // if binding a parameter threw.
+    if (_pending > 0) {
+      try {
+        sync();
+      } catch (...) {
+      }
+    }
+    PQexitPipelineMode(_handle.native_handle());
+  }
+
+  void send(prepared_statement_t& prepared) {
+    prepared.send();
+    ++_pending;
+  }
+
+  size_t pending() const { return _pending; }
+
+  // Collects the results of all pending statements and returns the number of
+  // affected rows. Throws the first error, if any.
+  size_t sync() {
+    auto* native = _handle.native_handle();
+    if (PQpipelineSync(native) != 1) {
+      throw sqlpp::exception{PQerrorMessage(native)};
+    }
+
+    size_t affected_rows = 0;
+    std::exception_ptr error;
+    for (; _pending > 0; --_pending) {
+      PGresult* result = PQgetResult(native);
+      if (result) {
+        // The results of each statement are terminated by a nullptr.
+        while (PGresult* extra = PQgetResult(native)) {
+          PQclear(extra);
+        }
+      }
+      try {
+        affected_rows += pg_result_t{result}.affected_rows();
+      } catch (...) {
+        // Statements after a failed one are aborted, report the first error.
+        if (not error) {
+          error = std::current_exception();
+        }
+      }
+    }
+    // The result of the sync point itself.
+    PQclear(PQgetResult(native));
+
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    return affected_rows;
+  }
+
+ private:
+  connection_handle& _handle;
+  size_t _pending{0};
+};
+#endif
 }  // namespace detail
 
+// Cancels the statement that a connection is currently executing. Unlike the
+// connection, a cancel_handle can be used from any thread, e.g. by a watchdog,
+// and remains valid after the connection has been closed.
+class cancel_handle {
+ public:
+  explicit cancel_handle(PGconn* connection)
+      : _cancel{PQgetCancel(connection), PQfreeCancel} {
+    if (not _cancel) {
+      throw connection_exception{"cannot create cancel handle"};
+    }
+  }
+
+  // Asks the server to cancel the current statement, which then throws
+  // timeout_exception. Does nothing if no statement is running.
+  void cancel() const {
+    char error[256];
+    if (PQcancel(_cancel.get(), error, sizeof(error)) != 1) {
+      throw connection_exception{error};
+    }
+  }
+
+ private:
+  std::shared_ptr<PGcancel> _cancel;
+};
+
 // Base connection class
 class connection_base : public sqlpp::connection {
  public:
@@ -85,6 +217,7 @@ class connection_base : public sqlpp::connection {
   using _config_t = connection_config;
   using _config_ptr_t = std::shared_ptr<const _config_t>;
   using _handle_t = detail::connection_handle;
+  using _context_t = context_t;
 
   using _prepared_statement_t = prepared_statement_t;
 
@@ -92,6 +225,8 @@ class connection_base : public sqlpp::connection {
   friend class sqlpp::statement_handler_t;
 
   bool _transaction_active{false};
+  sqlpp::detail::prepared_sql_t _prepared_sql;
+  std::pmr::memory_resource* _memory_resource{std::pmr::get_default_resource()};
 
   void validate_connection_handle() const {
     if (!_handle.native_handle()) {
@@ -105,37 +240,103 @@ class connection_base : public sqlpp::connection {
     if constexpr (debug_enabled) {
       _handle.debug().log(log_category::statement, "executing: '{}'", stmt);
     }
+    _handle.deallocate_prepared_statements();
 
     return pg_result_t{PQexec(native_handle(), stmt.data())};
   }
 
+  // Serialized statements are prepared on the server once they have been
+  // executed config->prepare_threshold times.
+  pg_result_t _execute_statement_impl(const std::string& stmt) {
+    const auto threshold = _handle.config->prepare_threshold;
+    if (threshold == 0) {
+      return _execute_impl(stmt);
+    }
+    validate_connection_handle();
+    _handle.deallocate_prepared_statements();
+
+    auto& cache = _handle._auto_prepared;
+    auto& lru = _handle._auto_prepared_lru;
+    auto it = cache.find(stmt);
+    if (it == cache.end()) {
+      if (not cache.empty() and
+          cache.size() >= _handle.config->auto_prepare_cache_size) {
+        // Evict the least recently used entry.
+        const auto victim = cache.find(*lru.back());
+        if (not victim->second.name.empty()) {
+          _handle._pending_deallocations->push_back(
+              std::move(victim->second.name));
+        }
+        lru.pop_back();
+        cache.erase(victim);
+      }
+      it = cache.emplace(stmt, detail::connection_handle::auto_prepared_t{})
+               .first;
+      lru.push_front(&it->first);
+      it->second.lru = lru.begin();
+    } else {
+      lru.splice(lru.begin(), lru, it->second.lru);
+    }
+    auto& entry = it->second;
+    if (entry.name.empty()) {
+      if (++entry.executions < threshold) {
+        return _execute_impl(stmt);
+      }
+      auto name = _handle.get_prepared_statement_name();
+      if constexpr (debug_enabled) {
+        _handle.debug().log(log_category::statement,
+                            "auto-preparing as {}: '{}'", name, stmt);
+      }
+      // This will throw if preparation fails
+      pg_result_t{PQprepare(native_handle(), name.c_str(), stmt.c_str(),
+                            /*nParams*/ 0, /*paramTypes*/ nullptr)};
+      entry.name = std::move(name);
+    }
+
+    if constexpr (debug_enabled) {
+      _handle.debug().log(log_category::statement,
+                          "executing auto-prepared statement: {}", entry.name);
+    }
+    return pg_result_t{PQexecPrepared(native_handle(), entry.name.c_str(),
+                                      /*nParams*/ 0, /*paramValues*/ nullptr,
+                                      /*paramLengths*/ nullptr,
+                                      /*paramFormats*/ nullptr,
+                                      /*resultFormat*/ 0)};
+  }
+
   text_result_t select_impl(const std::string& stmt) {
-    return {_execute_impl(stmt), _handle.config.get()};
+    return {_execute_statement_impl(stmt), _handle.config.get(),
+            _memory_resource};
   }
 
   command_result insert_impl(const std::string& stmt) {
-    return {.affected_rows = _execute_impl(stmt).affected_rows()};
+    return {.affected_rows = _execute_statement_impl(stmt).affected_rows()};
   }
 
   command_result update_impl(const std::string& stmt) {
-    return {.affected_rows = _execute_impl(stmt).affected_rows()};
+    return {.affected_rows = _execute_statement_impl(stmt).affected_rows()};
   }
 
   command_result delete_from_impl(const std::string& stmt) {
-    return {.affected_rows = _execute_impl(stmt).affected_rows()};
+    return {.affected_rows = _execute_statement_impl(stmt).affected_rows()};
   }
 
   // prepared execution
   prepared_statement_t prepare_impl(const std::string& stmt,
-                                    const size_t& param_count) {
+                                    const size_t& param_count,
+                                    detail::prepare_mode mode) {
     validate_connection_handle();
-    return prepare_statement(_handle, stmt, param_count);
+    if (mode == detail::prepare_mode::unnamed) {
+      return prepare_unnamed_statement(_handle, stmt, param_count,
+                                       _memory_resource);
+    }
+    return prepare_statement(_handle, stmt, param_count, _memory_resource);
   }
 
   text_result_t run_prepared_select_impl(prepared_statement_t& prep) {
     validate_connection_handle();
     return {detail::execute_prepared_statement(_handle, prep),
-            _handle.config.get()};
+            _handle.config.get(), _memory_resource};
   }
 
   command_result run_prepared_execute_impl(prepared_statement_t& prep) {
@@ -171,9 +372,11 @@ class connection_base : public sqlpp::connection {
 
   // Prepared select
   template <typename Select>
-  _prepared_statement_t _prepare_select(const Select& s) {
+  _prepared_statement_t _prepare_select(
+      const Select& s,
+      detail::prepare_mode mode = detail::prepare_mode::named) {
     context_t context(this);
-    return prepare_impl(to_sql_string(context, s), context._count);
+    return prepare_impl(_prepared_sql(context, s), context._count, mode);
   }
 
   template <typename PreparedSelect>
@@ -191,9 +394,11 @@ class connection_base : public sqlpp::connection {
   }
 
   template <typename Insert>
-  prepared_statement_t _prepare_insert(const Insert& s) {
+  prepared_statement_t _prepare_insert(
+      const Insert& s,
+      detail::prepare_mode mode = detail::prepare_mode::named) {
     context_t context(this);
-    return prepare_impl(to_sql_string(context, s), context._count);
+    return prepare_impl(_prepared_sql(context, s), context._count, mode);
   }
 
   template <typename PreparedInsert>
@@ -211,9 +416,11 @@ class connection_base : public sqlpp::connection {
   }
 
   template <typename Update>
-  prepared_statement_t _prepare_update(const Update& s) {
+  prepared_statement_t _prepare_update(
+      const Update& s,
+      detail::prepare_mode mode = detail::prepare_mode::named) {
     context_t context(this);
-    return prepare_impl(to_sql_string(context, s), context._count);
+    return prepare_impl(_prepared_sql(context, s), context._count, mode);
   }
 
   template <typename PreparedUpdate>
@@ -231,9 +438,11 @@ class connection_base : public sqlpp::connection {
   }
 
   template <typename Delete>
-  prepared_statement_t _prepare_delete_from(const Delete& s) {
+  prepared_statement_t _prepare_delete_from(
+      const Delete& s,
+      detail::prepare_mode mode = detail::prepare_mode::named) {
     context_t context(this);
-    return prepare_impl(to_sql_string(context, s), context._count);
+    return prepare_impl(_prepared_sql(context, s), context._count, mode);
   }
 
   template <typename PreparedDelete>
@@ -251,9 +460,11 @@ class connection_base : public sqlpp::connection {
   }
 
   template <typename Execute>
-  _prepared_statement_t _prepare_execute(const Execute& s) {
+  _prepared_statement_t _prepare_execute(
+      const Execute& s,
+      detail::prepare_mode mode = detail::prepare_mode::named) {
     context_t context(this);
-    return prepare_impl(to_sql_string(context, s), context._count);
+    return prepare_impl(_prepared_sql(context, s), context._count, mode);
   }
 
   template <typename PreparedExecute>
@@ -294,6 +505,128 @@ class connection_base : public sqlpp::connection {
     return sqlpp::statement_handler_t{}.prepare(t, *this);
   }
 
+  //! Like prepare(t), but the serialized statement is memoized in `cache`,
+  //! keyed by the statement type and its sqlpp::dynamic_shape(). Values other
+  //! than parameters (e.g. `tab.id == 5`) are rejected at compile time.
+  template <typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto prepare(const T& t, sqlpp::serialization_cache& cache) {
+    sqlpp::serialization_cache_check_t<T>{}.verify();
+    return _prepared_sql.with_cache(cache, [&] { return prepare(t); });
+  }
+
+  //! Executes a prepared insert, update, delete or execute statement once per
+  //! element of `rows` (tuples of parameter values) within a transaction.
+  //! If libpq supports it, the statements are sent in pipeline mode, i.e.
+  //! without waiting for each result. Returns the total number of affected
+  //! rows.
+  template <typename PreparedStatement, typename Range>
+    requires(sqlpp::is_prepared_statement_v<PreparedStatement>)
+  size_t execute_many(PreparedStatement& prepared, const Range& rows) {
+#ifdef LIBPQ_HAS_PIPELINING
+    validate_connection_handle();
+    // Pending deallocations are only sent while no transaction is open.
+    _handle.deallocate_prepared_statements();
+    return sqlpp::detail::call_in_transaction(*this, [&]() -> size_t {
+      auto& statement =
+          sqlpp::statement_handler_t{}.get_prepared_statement(prepared);
+      const auto batch_size =
+          std::max<size_t>(_handle.config->pipeline_batch_size, 1);
+      auto pipeline = detail::pipeline_t{_handle};
+      size_t affected_rows = 0;
+      for (const auto& row : rows) {
+        prepared.parameters._set(row);
+        sqlpp::statement_handler_t{}.bind_parameters(prepared);
+        pipeline.send(statement);
+        if (pipeline.pending() == batch_size) {
+          affected_rows += pipeline.sync();
+        }
+      }
+      return affected_rows + pipeline.sync();
+    });
+#else
+    return sqlpp::detail::execute_many(*this, prepared, rows);
+#endif
+  }
+
+  //! Like operator() for select statements, but reads each row directly into
+  //! a Struct, matching members and result columns by name. Requires C++26
+  //! reflection, see docs/select.md.
+  template <typename Struct, typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto select_into(const T& t) {
+    sqlpp::check_run_consistency(t).verify();
+    sqlpp::check_compatibility<context_t>(t).verify();
+    return sqlpp::detail::select_into<Struct>(t, *this);
+  }
+
+  template <typename Struct, typename T>
+    requires(sqlpp::is_prepared_statement_v<std::decay_t<T>>)
+  auto select_into(T&& t) {
+    return sqlpp::detail::select_into<Struct>(std::forward<T>(t), *this);
+  }
+
+  //! Like operator() for select statements, but reads fields only when they
+  //! are accessed, e.g. via `row.id()`. See docs/select.md.
+  template <typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto select_lazy(const T& t) {
+    sqlpp::check_run_consistency(t).verify();
+    sqlpp::check_compatibility<context_t>(t).verify();
+    return sqlpp::detail::select_lazy(t, *this);
+  }
+
+  template <typename T>
+    requires(sqlpp::is_prepared_statement_v<std::decay_t<T>>)
+  auto select_lazy(T&& t) {
+    return sqlpp::detail::select_lazy(std::forward<T>(t), *this);
+  }
+
+  //! Like prepare(), but without creating a named statement on the server.
+  //! Each execution sends the statement together with the parameters
+  //! (PQexecParams), i.e. one round-trip and nothing to deallocate.
+  //! Use this for parameterized statements that are executed once.
+  template <typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto prepare_unnamed(const T& t) {
+    sqlpp::check_prepare_consistency(t).verify();
+    sqlpp::check_compatibility<context_t>(t).verify();
+    return sqlpp::statement_handler_t{}.prepare(t, *this,
+                                                detail::prepare_mode::unnamed);
+  }
+
+  //! Memory resource for the buffers of prepared statements and results
+  //! created by this connection, e.g. a per-request arena. These must not
+  //! outlive the resource. nullptr selects the default resource.
+  void set_memory_resource(std::pmr::memory_resource* resource) {
+    _memory_resource =
+        resource ? resource : std::pmr::get_default_resource();
+  }
+
+  std::pmr::memory_resource* get_memory_resource() const {
+    return _memory_resource;
+  }
+
+  //! Statements running longer than `timeout` are canceled by the server and
+  //! throw timeout_exception. 0 disables the timeout. Applies to the session,
+  //! i.e. pooled connections keep it. Throws if a transaction is active, as
+  //! the setting would be undone if the transaction is rolled back.
+  void set_statement_timeout(std::chrono::milliseconds timeout) {
+    validate_connection_handle();
+    if (PQtransactionStatus(native_handle()) != PQTRANS_IDLE) {
+      throw sqlpp::exception{
+          "cannot set the statement timeout within a transaction"};
+    }
+    _handle.set_statement_timeout(timeout);
+  }
+
+  //! Returns a handle that can cancel statements of this connection from
+  //! other threads.
+  cancel_handle get_cancel_handle() const {
+    validate_connection_handle();
+    return cancel_handle{native_handle()};
+  }
+
   //! set the default transaction isolation level to use for new transactions
   void set_default_isolation_level(isolation_level level) {
     std::string level_str = "read uncommmitted";
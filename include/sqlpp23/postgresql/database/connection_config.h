@@ -27,6 +27,8 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 
@@ -67,6 +69,24 @@ struct connection_config {
   std::string krbsrvname;
   std::string service;
   // bool auto_reconnect {true};
+  // Destroyed prepared statements are deallocated on the server in batches
+  // of this size, see docs/connectors/postgresql.md.
+  size_t deallocate_batch_size{16}; // not compared
+  // Statements (not prepared by the user) that are executed this many times
+  // with the same SQL text are prepared on the server. 0 disables this.
+  // The cache key is the full SQL text, i.e. statements that embed values
+  // (instead of using parameters) are tracked separately per value.
+  size_t prepare_threshold{0}; // not compared
+  // Maximum number of statement texts tracked for prepare_threshold. The least
+  // recently used one is evicted (and deallocated on the server).
+  size_t auto_prepare_cache_size{256}; // not compared
+  // Number of statements that execute_many() sends in pipeline mode before
+  // waiting for their results.
+  size_t pipeline_batch_size{256}; // not compared
+  // Statements running longer than this are canceled by the server and throw
+  // timeout_exception. 0 disables the timeout, see
+  // connection_base::set_statement_timeout().
+  std::chrono::milliseconds statement_timeout{0}; // not compared
   debug_logger debug; // not compared
 
   bool operator==(const connection_config& other) {
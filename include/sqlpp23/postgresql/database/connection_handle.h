@@ -27,8 +27,15 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <list>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 #include <libpq-fe.h>
 
@@ -40,6 +47,22 @@ struct connection_handle {
   std::shared_ptr<const connection_config> config;
   std::unique_ptr<PGconn, void (*)(PGconn*)> postgres;
   size_t _prepared_statement_count = 0;
+  // Names of destroyed prepared statements that still need to be deallocated
+  // on the server. Shared with the prepared statements, which may outlive the
+  // connection.
+  std::shared_ptr<std::vector<std::string>> _pending_deallocations =
+      std::make_shared<std::vector<std::string>>();
+
+  // Execution counts and names of server-side statements for
+  // connection_config::prepare_threshold, keyed by SQL text.
+  struct auto_prepared_t {
+    size_t executions = 0;
+    std::string name;  // Empty until prepared
+    std::list<const std::string*>::iterator lru;
+  };
+  std::unordered_map<std::string, auto_prepared_t> _auto_prepared;
+  // Keys of _auto_prepared, most recently used first.
+  std::list<const std::string*> _auto_prepared_lru;
 
   connection_handle() : config{}, postgres{nullptr, PQfinish} {}
 
@@ -148,6 +171,10 @@ struct connection_handle {
     if (is_connected() == false) {
       throw connection_exception{PQerrorMessage(native_handle())};
     }
+
+    if (config->statement_timeout.count() > 0) {
+      set_statement_timeout(config->statement_timeout);
+    }
   }
 
   connection_handle(const connection_handle&) = delete;
@@ -173,6 +200,54 @@ struct connection_handle {
 
   PGconn* native_handle() const { return postgres.get(); }
 
+  // Sends the pending DEALLOCATEs in a single round-trip once there are
+  // enough of them. Deferred while a transaction is open (a failing DEALLOCATE
+  // would abort it) or the connection is broken. Names stay queued until their
+  // deallocation succeeded or the server reported them as unknown.
+  void deallocate_prepared_statements() {
+    auto& pending = *_pending_deallocations;
+    if (pending.empty() or pending.size() < config->deallocate_batch_size) {
+      return;
+    }
+    if (not is_connected()) {
+      return;
+    }
+    if (PQtransactionStatus(native_handle()) != PQTRANS_IDLE) {
+      return;
+    }
+    std::string cmd;
+    for (const auto& name : pending) {
+      cmd += "DEALLOCATE \"" + name + "\";";
+    }
+    if constexpr (debug_enabled) {
+      config->debug.log(log_category::statement, "deallocating: {}", cmd);
+    }
+    if (_deallocate(cmd)) {
+      pending.clear();
+      return;
+    }
+    // The batch stopped at the first failure. Retry the names one by one and
+    // drop those that the server does not know, e.g. after DISCARD ALL.
+    std::erase_if(pending, [this](const std::string& name) {
+      return _deallocate("DEALLOCATE \"" + name + "\"") or
+             _last_sql_state == invalid_sql_statement_name;
+    });
+  }
+
+  void set_statement_timeout(std::chrono::milliseconds timeout) {
+    const auto cmd = "SET statement_timeout = " +
+                     std::to_string(std::max<int64_t>(timeout.count(), 0));
+    if constexpr (debug_enabled) {
+      config->debug.log(log_category::connection, "{}", cmd);
+    }
+    auto* result = PQexec(native_handle(), cmd.c_str());
+    const auto ok = PQresultStatus(result) == PGRES_COMMAND_OK;
+    PQclear(result);
+    if (not ok) {
+      throw connection_exception{PQerrorMessage(native_handle())};
+    }
+  }
+
   bool is_connected() const {
     return native_handle() and (PQstatus(native_handle()) == CONNECTION_OK);
   }
@@ -189,5 +264,28 @@ struct connection_handle {
   }
 
   const debug_logger& debug() { return config->debug; }
+
+ private:
+  static constexpr std::string_view invalid_sql_statement_name = "26000";
+
+  std::string _last_sql_state;
+
+  // Returns true on success. Otherwise, logs the error and remembers its SQL
+  // state.
+  bool _deallocate(const std::string& cmd) {
+    const auto result = std::unique_ptr<PGresult, void (*)(PGresult*)>{
+        PQexec(native_handle(), cmd.c_str()), PQclear};
+    if (PQresultStatus(result.get()) == PGRES_COMMAND_OK) {
+      return true;
+    }
+    const char* sql_state =
+        PQresultErrorField(result.get(), PG_DIAG_SQLSTATE);
+    _last_sql_state = sql_state ? sql_state : "";
+    if constexpr (debug_enabled) {
+      config->debug.log(log_category::statement, "deallocation failed: {}",
+                        PQresultErrorMessage(result.get()));
+    }
+    return false;
+  }
 };
 }  // namespace sqlpp::postgresql::detail
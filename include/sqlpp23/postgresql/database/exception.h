@@ -69,4 +69,27 @@ class result_exception : public sqlpp::exception {
   // Returns value of PQresultErrorField(_pg_result.get(), PG_DIAG_SQLSTATE)
   std::string_view sql_state() const { return _sql_state; }
 };
+
+// Thrown when the server canceled a statement (SQLSTATE 57014), i.e. the
+// statement exceeded connection_config::statement_timeout or was canceled via
+// a cancel_handle.
+class timeout_exception : public result_exception {
+ public:
+  using result_exception::result_exception;
+};
+
+namespace detail {
+inline constexpr std::string_view query_canceled_sql_state = "57014";
+
+[[noreturn]] inline void throw_result_exception(const PGresult* pg_result) {
+  const char* sql_state = PQresultErrorField(pg_result, PG_DIAG_SQLSTATE);
+  const auto state = std::string{sql_state ? sql_state : ""};
+  if (state == query_canceled_sql_state) {
+    throw timeout_exception{PQresultErrorMessage(pg_result),
+                            PQresultStatus(pg_result), state};
+  }
+  throw result_exception{PQresultErrorMessage(pg_result),
+                         PQresultStatus(pg_result), state};
+}
+}  // namespace detail
 }  // namespace sqlpp
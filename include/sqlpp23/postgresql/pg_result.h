@@ -50,10 +50,7 @@ class pg_result_t {
       case PGRES_SINGLE_TUPLE:
         return;
       default:
-        throw result_exception{
-            PQresultErrorMessage(_pg_result.get()),
-            PQresultStatus(_pg_result.get()),
-            PQresultErrorField(_pg_result.get(), PG_DIAG_SQLSTATE)};
+        detail::throw_result_exception(_pg_result.get());
     }
   }
 
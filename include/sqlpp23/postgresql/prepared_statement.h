@@ -28,12 +28,20 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <charconv>
+#include <format>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
 #include <string>
+#include <vector>
 
 #include <libpq-fe.h>
 
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/debug_logger.h>
+#include <sqlpp23/core/detail/hex.h>
 #include <sqlpp23/core/to_sql_string.h>
 #include <sqlpp23/postgresql/database/connection_handle.h>
 #include <sqlpp23/postgresql/database/serializer_context.h>
@@ -55,14 +63,28 @@ class prepared_statement_t {
   friend class sqlpp::postgresql::connection_base;
 
   ::PGconn* _connection;
-  std::string _name;
+  std::string _name;  // Empty for unnamed statements
+  std::string _statement;  // Only kept for unnamed statements
+  std::shared_ptr<std::vector<std::string>> _pending_deallocations;
 
    // Parameters
-  std::vector<bool> _stmt_null_parameters;
-  std::vector<std::string> _stmt_parameters;
+  std::pmr::vector<bool> _stmt_null_parameters;
+  std::pmr::vector<std::pmr::string> _stmt_parameters;
+  // Re-used by each execution, see parameter_values().
+  std::pmr::vector<const char*> _stmt_parameter_values;
+  std::pmr::string _array_buffer;
 
   const connection_config* _config;
 
+  const std::pmr::vector<const char*>& parameter_values() {
+    const size_t size = _stmt_parameters.size();
+    for (size_t i = 0u; i < size; i++) {
+      _stmt_parameter_values[i] =
+          _stmt_null_parameters[i] ? nullptr : _stmt_parameters[i].c_str();
+    }
+    return _stmt_parameter_values;
+  }
+
  public:
   prepared_statement_t() = delete;
   // ctor
@@ -70,10 +92,18 @@ class prepared_statement_t {
                        const std::string& statement,
                        std::string name,
                        size_t no_of_parameters,
-                       const connection_config* config)
-      : _connection{connection},_name{std::move(name)},
-        _stmt_null_parameters(no_of_parameters, false),
-        _stmt_parameters(no_of_parameters, std::string{}),
+                       const connection_config* config,
+                       std::shared_ptr<std::vector<std::string>>
+                           pending_deallocations = nullptr,
+                       std::pmr::memory_resource* memory_resource =
+                           std::pmr::get_default_resource())
+      : _connection{connection},
+        _name{std::move(name)},
+        _pending_deallocations{std::move(pending_deallocations)},
+        _stmt_null_parameters(no_of_parameters, false, memory_resource),
+        _stmt_parameters(no_of_parameters, memory_resource),
+        _stmt_parameter_values(no_of_parameters, nullptr, memory_resource),
+        _array_buffer(memory_resource),
         _config{config} {
     if constexpr (debug_enabled) {
       config->debug.log(log_category::statement,
@@ -81,6 +111,12 @@ class prepared_statement_t {
                         std::hash<void*>{}(_connection));
     }
 
+    if (_name.empty()) {
+      // Unnamed statements are sent with the parameters on execution.
+      _statement = statement;
+      return;
+    }
+
     // This will throw if preparation fails
     pg_result_t{PQprepare(_connection, _name.c_str(), statement.c_str(),
                           /*nParams*/ 0, /*paramTypes*/ nullptr)};
@@ -91,11 +127,12 @@ class prepared_statement_t {
   prepared_statement_t& operator=(const prepared_statement_t&) = delete;
   prepared_statement_t& operator=(prepared_statement_t&&) = default;
   ~prepared_statement_t() {
-    // PQclosePrepared is not available in all versions
-    // See https://www.postgresql.org/docs/16/libpq-exec.html
-    std::string cmd = "DEALLOCATE \"" + _name + "\"";
-    PGresult* result = PQexec(_connection, cmd.c_str());
-    PQclear(result);
+    // Deallocation is deferred to avoid a round-trip per statement, see
+    // connection_handle::deallocate_prepared_statements().
+    if (_name.empty() or not _pending_deallocations) {
+      return;
+    }
+    _pending_deallocations->push_back(std::move(_name));
   }
 
   bool operator==(const prepared_statement_t& rhs) {
@@ -105,23 +142,51 @@ class prepared_statement_t {
   const std::string& name() const { return _name; }
 
   pg_result_t execute() {
-    const size_t size = _stmt_parameters.size();
-
-    std::vector<const char*> values;
-    values.reserve(size);
-    for (size_t i = 0u; i < size; i++) {
-      values.push_back(_stmt_null_parameters[i] ? nullptr
-                                                : _stmt_parameters[i].c_str());
+    const auto& values = parameter_values();
+
+    if (_name.empty()) {
+      // Parse, bind, and execute in a single round-trip.
+      return pg_result_t{PQexecParams(_connection, _statement.c_str(),
+                                      /*nParams*/ static_cast<int>(values.size()),
+                                      /*paramTypes*/ nullptr,
+                                      /*paramValues*/ values.data(),
+                                      /*paramLengths*/ nullptr,
+                                      /*paramFormats*/ nullptr,
+                                      /*resultFormat*/ 0)};
     }
 
     // Execute prepared statement with the parameters.
     return pg_result_t{PQexecPrepared(_connection, /*stmtName*/ _name.data(),
-                                 /*nParams*/ static_cast<int>(size),
+                                 /*nParams*/ static_cast<int>(values.size()),
                                  /*paramValues*/ values.data(),
                                  /*paramLengths*/ nullptr,
                                  /*paramFormats*/ nullptr, /*resultFormat*/ 0)};
   }
 
+  // Sends the statement with the parameters without waiting for the result,
+  // e.g. in pipeline mode.
+  void send() {
+    const auto& values = parameter_values();
+
+    const int sent =
+        _name.empty()
+            ? PQsendQueryParams(_connection, _statement.c_str(),
+                                /*nParams*/ static_cast<int>(values.size()),
+                                /*paramTypes*/ nullptr,
+                                /*paramValues*/ values.data(),
+                                /*paramLengths*/ nullptr,
+                                /*paramFormats*/ nullptr, /*resultFormat*/ 0)
+            : PQsendQueryPrepared(_connection, /*stmtName*/ _name.data(),
+                                  /*nParams*/ static_cast<int>(values.size()),
+                                  /*paramValues*/ values.data(),
+                                  /*paramLengths*/ nullptr,
+                                  /*paramFormats*/ nullptr,
+                                  /*resultFormat*/ 0);
+    if (sent != 1) {
+      throw sqlpp::exception{PQerrorMessage(_connection)};
+    }
+  }
+
   auto& debug() const { return _config->debug; }
 
   void bind_parameter(size_t parameter_index, const bool& value) {
@@ -135,27 +200,34 @@ class prepared_statement_t {
 
   void bind_parameter(size_t parameter_index, const double& value) {
     _stmt_null_parameters[parameter_index] = false;
+    // Formatting into the existing string re-uses its capacity.
+    auto& param = _stmt_parameters[parameter_index];
+    param.clear();
     context_t context{nullptr};
-    using sqlpp::to_sql_string;
-    _stmt_parameters[parameter_index] = to_sql_string(context, value);
+    sqlpp::append_float_to_sql_string(context, param, value);
   }
 
   void bind_parameter(size_t parameter_index, const int64_t& value) {
     // Assign values
     _stmt_null_parameters[parameter_index] = false;
-    _stmt_parameters[parameter_index] = std::to_string(value);
+    char buffer[std::numeric_limits<int64_t>::digits10 + 2];
+    const auto [end, ec] =
+        std::to_chars(std::begin(buffer), std::end(buffer), value);
+    _stmt_parameters[parameter_index].assign(buffer, end);
   }
 
   void bind_parameter(size_t parameter_index, const std::string& value) {
     // Assign values
     _stmt_null_parameters[parameter_index] = false;
-    _stmt_parameters[parameter_index] = value;
+    _stmt_parameters[parameter_index].assign(value);
   }
 
   void bind_parameter(size_t parameter_index, const std::chrono::sys_days& value) {
     _stmt_null_parameters[parameter_index] = false;
     const auto ymd = std::chrono::year_month_day{value};
-    _stmt_parameters[parameter_index] = std::format("{}", ymd);
+    auto& param = _stmt_parameters[parameter_index];
+    param.clear();
+    std::format_to(std::back_inserter(param), "{}", ymd);
 
     if constexpr (debug_enabled) {
       _config->debug.log(log_category::parameter,
@@ -171,7 +243,9 @@ class prepared_statement_t {
         std::chrono::floor<::std::chrono::microseconds>(value - dp));
 
     // Timezone handling - always treat the local value as UTC.
-    _stmt_parameters[parameter_index] = std::format("{}+00", time);
+    auto& param = _stmt_parameters[parameter_index];
+    param.clear();
+    std::format_to(std::back_inserter(param), "{}+00", time);
     if constexpr (debug_enabled) {
       _config->debug.log(log_category::parameter,
                            "binding time parameter string: {}",
@@ -188,7 +262,9 @@ class prepared_statement_t {
     const auto ymd = std::chrono::year_month_day{dp};
 
     // Timezone handling - always treat the local value as UTC.
-    _stmt_parameters[parameter_index] = std::format("{} {}+00", ymd, time);
+    auto& param = _stmt_parameters[parameter_index];
+    param.clear();
+    std::format_to(std::back_inserter(param), "{} {}+00", ymd, time);
     if constexpr (debug_enabled) {
       _config->debug.log(log_category::parameter,
                            "binding date_time parameter string: {}",
@@ -198,18 +274,11 @@ class prepared_statement_t {
 
   void bind_parameter(size_t parameter_index, const std::vector<unsigned char>& value) {
     _stmt_null_parameters[parameter_index] = false;
-    constexpr char hex_chars[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
-                                    '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
-    auto param = std::string(value.size() * 2 + 2,
-                             '\0');  // ()-init for correct constructor
+    auto& param = _stmt_parameters[parameter_index];
+    param.resize(value.size() * 2 + 2);
     param[0] = '\\';
     param[1] = 'x';
-    auto i = size_t{1};
-    for (const auto c : value) {
-      param[++i] = hex_chars[c >> 4];
-      param[++i] = hex_chars[c & 0x0F];
-    }
-    _stmt_parameters[parameter_index] = std::move(param);
+    ::sqlpp::detail::hex_encode(value.data(), value.size(), param.data() + 2);
     if constexpr (debug_enabled) {
       _config->debug.log(log_category::parameter,
                          "binding blob parameter string (up to 100 "
@@ -218,6 +287,40 @@ class prepared_statement_t {
     }
   }
 
+  // Binds all values as a single array literal, e.g. {"1","2","3"}.
+  template <typename Value, size_t Capacity>
+  void bind_parameter(size_t parameter_index,
+                      const array_parameter_value<Value, Capacity>& value) {
+    check_array_parameter_size(value);
+    // Built in a separate buffer, which then swaps places with the parameter.
+    auto& array = _array_buffer;
+    array.assign(1, '{');
+    for (const auto& element : value) {
+      if (array.size() > 1) {
+        array.push_back(',');
+      }
+      // Re-use the scalar conversion, then quote the element.
+      bind_parameter(parameter_index, element);
+      array.push_back('"');
+      for (const char c : _stmt_parameters[parameter_index]) {
+        if (c == '"' or c == '\\') {
+          array.push_back('\\');
+        }
+        array.push_back(c);
+      }
+      array.push_back('"');
+    }
+    array.push_back('}');
+    _stmt_null_parameters[parameter_index] = false;
+    std::swap(_stmt_parameters[parameter_index], array);
+    if constexpr (debug_enabled) {
+      _config->debug.log(log_category::parameter,
+                         "binding array parameter string (up to 100 "
+                         "chars): {}",
+                         _stmt_parameters[parameter_index].substr(0, 100));
+    }
+  }
+
   void bind_null(size_t parameter_index) {
     if constexpr (debug_enabled) {
       _config->debug.log(log_category::parameter,
@@ -316,4 +419,24 @@ inline void bind_parameter(prepared_statement_t& statement,
   }
   statement.bind_parameter(parameter_index, value);
 }
+
+template <typename Value, size_t Capacity>
+void bind_parameter(prepared_statement_t& statement,
+                    size_t parameter_index,
+                    const array_parameter_value<Value, Capacity>& value) {
+  if constexpr (debug_enabled) {
+    statement.debug().log(log_category::parameter,
+                          "binding array parameter at parameter_index {}",
+                          parameter_index);
+  }
+  statement.bind_parameter(parameter_index, value);
+}
 }  // namespace sqlpp::postgresql
+
+namespace sqlpp {
+// PostgreSQL binds array parameters to a single placeholder.
+template <typename Value, size_t Capacity>
+struct placeholder_count<postgresql::prepared_statement_t,
+                         array_parameter_value<Value, Capacity>>
+    : public std::integral_constant<size_t, 1> {};
+}  // namespace sqlpp
@@ -27,14 +27,18 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <memory_resource>
 #include <span>
 #include <string_view>
+#include <vector>
 
 #include <libpq-fe.h>
 #include <pg_config.h>
 
 #include <sqlpp23/core/chrono.h>
+#include <sqlpp23/core/detail/hex.h>
 #include <sqlpp23/core/detail/parse_date_time.h>
+#include <sqlpp23/core/detail/parse_number.h>
 #include <sqlpp23/core/query/result_row.h>
 #include <sqlpp23/postgresql/database/connection_config.h>
 #include <sqlpp23/postgresql/database/exception.h>
@@ -44,53 +48,24 @@ namespace sqlpp::postgresql {
 namespace detail {
 struct statement_handle_t;
 
-inline unsigned char unhex(unsigned char c) {
-  switch (c) {
-    case '0':
-    case '1':
-    case '2':
-    case '3':
-    case '4':
-    case '5':
-    case '6':
-    case '7':
-    case '8':
-    case '9':
-      return c - '0';
-    case 'a':
-    case 'b':
-    case 'c':
-    case 'd':
-    case 'e':
-    case 'f':
-      return c + 10 - 'a';
-    case 'A':
-    case 'B':
-    case 'C':
-    case 'D':
-    case 'E':
-    case 'F':
-      return c + 10 - 'A';
-  }
-  throw sqlpp::exception{std::string{"Unexpected hex char: "} +
-                         static_cast<char>(c)};
-}
-
-inline size_t hex_assign(std::vector<uint8_t>& value,
+// Decodes bytea values in hex format, e.g. \x0A1B2C
+inline size_t hex_assign(std::pmr::vector<uint8_t>& value,
                          const uint8_t* blob,
                          size_t len) {
-  const auto result_size = len / 2 - 1;  // unhex - leading chars
+  constexpr size_t prefix_size = 2;  // \x
+  if (len < prefix_size) {
+    return 0;
+  }
+  const auto hex_size = len - prefix_size;
+  const auto result_size = hex_size / 2;
   if (value.size() < result_size) {
-    value.resize(result_size);  // unhex - leading chars
+    value.resize(result_size);
   }
-  size_t val_index = 0;
-  size_t blob_index = 2;
-  while (blob_index < len) {
-    value[val_index] =
-        static_cast<unsigned char>(unhex(blob[blob_index]) << 4) +
-        unhex(blob[blob_index + 1]);
-    ++val_index;
-    blob_index += 2;
+  const auto* hex = reinterpret_cast<const char*>(blob) + prefix_size;
+  const auto invalid = ::sqlpp::detail::hex_decode(hex, hex_size, value.data());
+  if (invalid != hex_size) {
+    throw sqlpp::exception{std::string{"Unexpected hex char: "} +
+                           hex[invalid]};
   }
   return result_size;
 }
@@ -105,7 +80,7 @@ class text_result_t {
   int _row_count = 0;
   int _field_count = 0;
   // Need to buffer blobs (or switch to PQexecParams with binary results)
-  std::vector<std::vector<uint8_t>> _var_buffers;
+  std::pmr::vector<std::pmr::vector<uint8_t>> _var_buffers;
 
   bool next_impl() {
     if constexpr (debug_enabled) {
@@ -125,13 +100,15 @@ class text_result_t {
  public:
   text_result_t() = default;
 
-  text_result_t(pg_result_t pg_result, const connection_config* config)
+  text_result_t(pg_result_t pg_result,
+                const connection_config* config,
+                std::pmr::memory_resource* memory_resource =
+                    std::pmr::get_default_resource())
       : _pg_result{std::move(pg_result)},
         _config{config},
         _row_count{PQntuples(_pg_result.get())},
         _field_count{PQnfields(_pg_result.get())},
-        _var_buffers{static_cast<size_t>(_field_count),
-                     std::vector<uint8_t>{}} {
+        _var_buffers{memory_resource} {
     if constexpr (debug_enabled) {
       _config->debug.log(log_category::result,
                          "constructing bind result, using handle at {}",
@@ -143,10 +120,7 @@ class text_result_t {
       case PGRES_SINGLE_TUPLE:
         return;
       default:
-        throw result_exception{
-            PQresultErrorMessage(_pg_result.get()),
-            PQresultStatus(_pg_result.get()),
-            PQresultErrorField(_pg_result.get(), PG_DIAG_SQLSTATE)};
+        detail::throw_result_exception(_pg_result.get());
     }
   }
 
@@ -173,7 +147,17 @@ class text_result_t {
     return static_cast<size_t>(PQgetlength(_pg_result.get(), _row_index,
                        static_cast<int>(field_index)));
   }
-  auto& var_buffer(size_t field_index) { return _var_buffers[field_index]; }
+  std::string_view get_field_text(size_t field_index) const {
+    return std::string_view(get_field_value(field_index),
+                            get_field_length(field_index));
+  }
+  auto& var_buffer(size_t field_index) {
+    // Only allocated when reading blobs.
+    if (_var_buffers.empty()) {
+      _var_buffers.resize(static_cast<size_t>(_field_count));
+    }
+    return _var_buffers[field_index];
+  }
 
   bool operator==(const text_result_t& rhs) const {
     return (this->_pg_result.get() == rhs._pg_result.get());
@@ -227,7 +211,7 @@ inline void read_field(const text_result_t& result,
                        field_index);
   }
 
-  value = std::strtod(result.get_field_value(field_index), nullptr);
+  ::sqlpp::detail::parse_number(value, result.get_field_text(field_index));
 }
 
 inline void read_field(const text_result_t& result,
@@ -238,7 +222,7 @@ inline void read_field(const text_result_t& result,
                        "reading integral result at index: {}", field_index);
   }
 
-  value = std::strtoll(result.get_field_value(field_index), nullptr, 10);
+  ::sqlpp::detail::parse_number(value, result.get_field_text(field_index));
 }
 
 inline void read_field(const text_result_t& result,
@@ -251,7 +235,7 @@ inline void read_field(const text_result_t& result,
         field_index);
   }
 
-  value = std::strtoull(result.get_field_value(field_index), nullptr, 10);
+  ::sqlpp::detail::parse_number(value, result.get_field_text(field_index));
 }
 
 inline void read_field(const text_result_t& result,
@@ -281,7 +265,7 @@ inline void read_field(const text_result_t& result,
                        field_index);
   }
 
-  const char* date_string = result.get_field_value(field_index);
+  auto date_string = result.get_field_text(field_index);
   if constexpr (debug_enabled) {
     result.debug().log(log_category::result, "date string: {}", date_string);
   }
@@ -291,7 +275,7 @@ inline void read_field(const text_result_t& result,
     }
   }
 
-  if (*date_string) {
+  if (not date_string.empty()) {
     if constexpr (debug_enabled) {
       result.debug().log(log_category::result,
                          "trailing characters in date result: {}", date_string);
@@ -308,7 +292,7 @@ inline void read_field(const text_result_t& result,
                        "reading date_time result at index {}", field_index);
   }
 
-  const char* date_time_string = result.get_field_value(field_index);
+  auto date_time_string = result.get_field_text(field_index);
   if constexpr (debug_enabled) {
     result.debug().log(log_category::result, "got date_time string: {}",
                        date_time_string);
@@ -319,7 +303,7 @@ inline void read_field(const text_result_t& result,
     }
   }
 
-  if (*date_time_string) {
+  if (not date_time_string.empty()) {
     if constexpr (debug_enabled) {
       result.debug().log(log_category::result,
                          "trailing characters in date_time result: {}",
@@ -337,7 +321,7 @@ inline void read_field(const text_result_t& result,
                        field_index);
   }
 
-  const char* time_string = result.get_field_value(field_index);
+  auto time_string = result.get_field_text(field_index);
 
   if constexpr (debug_enabled) {
     result.debug().log(log_category::result, "got time string: {}",
@@ -350,7 +334,7 @@ inline void read_field(const text_result_t& result,
     }
   }
 
-  if (*time_string) {
+  if (not time_string.empty()) {
     if constexpr (debug_enabled) {
       result.debug().log(log_category::result,
                          "trailing characters in date_time result: {}",
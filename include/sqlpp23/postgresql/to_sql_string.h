@@ -29,9 +29,17 @@
 
 #include <sqlpp23/core/basic/parameter.h>
 #include <sqlpp23/core/chrono.h>
+#include <sqlpp23/core/detail/hex.h>
+#include <sqlpp23/core/operator/in_expression.h>
 #include <sqlpp23/core/to_sql_string.h>
 #include <sqlpp23/postgresql/database/serializer_context.h>
 
+namespace sqlpp {
+// In PostgreSQL, NULL is larger than any other value.
+template <>
+struct nulls_sort_first<postgresql::context_t> : public std::false_type {};
+}  // namespace sqlpp
+
 namespace sqlpp::postgresql {
 // Serialize parameters
 template <typename DataType, typename NameType>
@@ -40,20 +48,44 @@ auto to_sql_string(postgresql::context_t& context,
   return std::string("$") + std::to_string(++context._count);
 }
 
+// Array parameters are bound as a single PostgreSQL array
+template <typename DataType, typename NameType, size_t Capacity>
+auto to_sql_string(postgresql::context_t& context,
+                   const array_parameter_t<DataType, NameType, Capacity>&)
+    -> std::string {
+  return std::string("$") + std::to_string(++context._count);
+}
+
+template <typename L, typename DataType, typename NameType, size_t Capacity>
+auto to_sql_string(
+    postgresql::context_t& context,
+    const in_expression<L,
+                        operator_in,
+                        array_parameter_t<DataType, NameType, Capacity>>& t)
+    -> std::string {
+  return operand_to_sql_string(context, read.lhs(t)) + " = ANY(" +
+         to_sql_string(context, read.rhs(t)) + ")";
+}
+
+template <typename L, typename DataType, typename NameType, size_t Capacity>
+auto to_sql_string(
+    postgresql::context_t& context,
+    const in_expression<L,
+                        operator_not_in,
+                        array_parameter_t<DataType, NameType, Capacity>>& t)
+    -> std::string {
+  return operand_to_sql_string(context, read.lhs(t)) + " <> ALL(" +
+         to_sql_string(context, read.rhs(t)) + ")";
+}
+
 // MySQL and sqlite3 use x'...', but PostgreSQL uses '\x...' to encode
 // hexadecimal literals
 inline auto to_sql_string(postgresql::context_t&,
                           const std::span<const uint8_t>& t) -> std::string {
-  constexpr char hex_chars[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
-                                  '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
-  auto result = std::string("'\\x");
-  result.reserve(t.size() * 2 + 4);
-  for (const auto c : t) {
-    result.push_back(hex_chars[c >> 4]);
-    result.push_back(hex_chars[c & 0x0F]);
-  }
-  result.push_back('\'');
-
+  auto result = std::string(t.size() * 2 + 4, '\'');
+  result[1] = '\\';
+  result[2] = 'x';
+  ::sqlpp::detail::hex_encode(t.data(), t.size(), result.data() + 3);
   return result;
 }
 
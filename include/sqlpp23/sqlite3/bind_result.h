@@ -39,6 +39,7 @@
 
 #include <sqlpp23/core/chrono.h>
 #include <sqlpp23/core/detail/parse_date_time.h>
+#include <sqlpp23/core/detail/parse_number.h>
 #include <sqlpp23/core/query/result_row.h>
 #include <sqlpp23/sqlite3/database/connection_config.h>
 #include <sqlpp23/sqlite3/database/exception.h>
@@ -114,6 +115,13 @@ class bind_result_t {
     return sqlite3_column_text(_sqlite3_statement.get(),
                                static_cast<int>(field_index));
   }
+  // sqlite3_column_bytes has to be called after sqlite3_column_text to yield
+  // the length of the text (as opposed to the length of a blob, for
+  // instance).
+  std::string_view get_text_view(size_t field_index) const {
+    const auto* text = reinterpret_cast<const char*>(get_text(field_index));
+    return std::string_view(text, static_cast<size_t>(get_bytes(field_index)));
+  }
   auto get_text16(size_t field_index) const {
     return sqlite3_column_text16(_sqlite3_statement.get(),
                                  static_cast<int>(field_index));
@@ -154,6 +162,8 @@ class bind_result_t {
         return true;
       case SQLITE_DONE:
         return false;
+      case SQLITE_INTERRUPT:
+        throw timeout_exception{std::string(sqlite3_errmsg(_connection)), rc};
       default:
         throw exception{std::string(sqlite3_errmsg(_connection)), rc};
     }
@@ -179,7 +189,7 @@ inline void read_field(const bind_result_t& result,
 
   switch (result.get_type(index)) {
     case (SQLITE3_TEXT):
-      value = atof(reinterpret_cast<const char*>(result.get_text(index)));
+      ::sqlpp::detail::parse_number(value, result.get_text_view(index));
       break;
     default:
       value = result.get_double(index);
@@ -216,9 +226,7 @@ inline void read_field(const bind_result_t& result,
                        "Sqlite3 debug: binding text result at index {}", index);
   }
 
-  value =
-      std::string_view(reinterpret_cast<const char*>(result.get_text(index)),
-                       static_cast<size_t>(result.get_bytes(index)));
+  value = result.get_text_view(index);
 }
 
 inline void read_field(const bind_result_t& result,
@@ -242,8 +250,7 @@ inline void read_field(const bind_result_t& result,
                        "Sqlite3 debug: binding date result at index {}", index);
   }
 
-  const char* time_string =
-      reinterpret_cast<const char*>(result.get_text(index));
+  auto time_string = result.get_text_view(index);
   if constexpr (debug_enabled) {
     result.debug().log(log_category::result, "Sqlite3 debug: time string {}",
                        time_string);
@@ -255,7 +262,7 @@ inline void read_field(const bind_result_t& result,
       result.debug().log(log_category::result, "Sqlite3 debug: invalid time");
     }
   }
-  if (*time_string) {
+  if (not time_string.empty()) {
     if constexpr (debug_enabled) {
       result.debug().log(log_category::result,
                          "trailing characters in time result: {}", time_string);
@@ -271,8 +278,7 @@ inline void read_field(const bind_result_t& result,
                        "Sqlite3 debug: binding date result at index {}", index);
   }
 
-  const char* date_string =
-      reinterpret_cast<const char*>(result.get_text(index));
+  auto date_string = result.get_text_view(index);
   if constexpr (debug_enabled) {
     result.debug().log(log_category::result, "Sqlite3 debug: date string: {}",
                        date_string);
@@ -284,7 +290,7 @@ inline void read_field(const bind_result_t& result,
       result.debug().log(log_category::result, "Sqlite3 debug: invalid date");
     }
   }
-  if (*date_string) {
+  if (not date_string.empty()) {
     if constexpr (debug_enabled) {
       result.debug().log(log_category::result,
                          "trailing characters in date result: {}", date_string);
@@ -300,8 +306,7 @@ inline void read_field(const bind_result_t& result,
                        "Sqlite3 debug: binding date result at index {}", index);
   }
 
-  const char* date_time_string =
-      reinterpret_cast<const char*>(result.get_text(index));
+  auto date_time_string = result.get_text_view(index);
   if constexpr (debug_enabled) {
     result.debug().log(log_category::result,
                        "Sqlite3 debug: date_time string: {}", date_time_string);
@@ -314,7 +319,7 @@ inline void read_field(const bind_result_t& result,
                          "Sqlite3 debug: invalid date_time");
     }
   }
-  if (*date_time_string) {
+  if (not date_time_string.empty()) {
     if constexpr (debug_enabled) {
       result.debug().log(log_category::result,
                          "trailing characters in date_time result: {}",
@@ -54,12 +54,12 @@ struct insert_or_result_methods_t {
     return statement_handler_t{}.insert(std::forward<Statement>(self), db);
   }
 
-  template <typename Statement, typename Db>
-  auto _prepare(this Statement&& self, Db& db)
+  template <typename Statement, typename Db, typename... Options>
+  auto _prepare(this Statement&& self, Db& db, Options... options)
       -> prepared_insert_t<Db, std::decay_t<Statement>> {
     return {{},
             statement_handler_t{}.prepare_insert(
-                std::forward<Statement>(self), db)};
+                std::forward<Statement>(self), db, options...)};
   }
 };
 }  // namespace sqlite3
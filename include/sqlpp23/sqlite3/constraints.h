@@ -35,6 +35,7 @@
 #include <sqlpp23/core/basic/join.h>
 #include <sqlpp23/core/basic/parameter.h>
 #include <sqlpp23/core/chrono.h>
+#include <sqlpp23/core/clause/for_update.h>
 #include <sqlpp23/core/clause/on_conflict.h>
 #include <sqlpp23/core/clause/returning.h>
 #include <sqlpp23/core/clause/using.h>
@@ -66,6 +67,34 @@ class assert_no_using_t : public wrapped_static_assert {
     static_assert(wrong<T...>, "Sqlite3: No support for USING");
   }
 };
+
+class assert_no_for_update_t : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>,
+                  "Sqlite3: No support for FOR UPDATE or other locking "
+                  "clauses");
+  }
+};
+
+class assert_no_mysql_index_hints_t : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>,
+                  "Sqlite3: No support for USE INDEX, FORCE INDEX or IGNORE "
+                  "INDEX, use indexed_by or not_indexed instead");
+  }
+};
+
+class assert_no_optimizer_hints_t : public wrapped_static_assert {
+ public:
+  template <typename... T>
+  static void verify(T&&...) {
+    static_assert(wrong<T...>, "Sqlite3: No support for optimizer hints");
+  }
+};
 }  // namespace sqlite3
 
 template <typename Select>
@@ -77,6 +106,25 @@ template <typename _Table>
 struct compatibility_check<sqlite3::context_t, using_t<_Table>> {
   using type = sqlite3::assert_no_using_t;
 };
+
+template <typename Strength, typename Wait>
+struct compatibility_check<sqlite3::context_t, locking_t<Strength, Wait>> {
+  using type = sqlite3::assert_no_for_update_t;
+};
+
+template <typename Table, typename Hint, typename... Indexes>
+  requires(std::is_same_v<Hint, use_index_t> or
+           std::is_same_v<Hint, force_index_t> or
+           std::is_same_v<Hint, ignore_index_t>)
+struct compatibility_check<sqlite3::context_t,
+                           index_hint_t<Table, Hint, Indexes...>> {
+  using type = sqlite3::assert_no_mysql_index_hints_t;
+};
+
+template <typename... Hints>
+struct compatibility_check<sqlite3::context_t, optimizer_hints_t<Hints...>> {
+  using type = sqlite3::assert_no_optimizer_hints_t;
+};
 }  // namespace sqlpp
 
 #if SQLITE_VERSION_NUMBER < 3039000
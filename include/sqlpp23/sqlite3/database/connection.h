@@ -28,6 +28,7 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
 #include <string>
 
 #ifdef SQLPP_USE_SQLCIPHER
@@ -37,7 +38,11 @@
 #endif
 #include <sqlpp23/core/basic/schema.h>
 #include <sqlpp23/core/database/connection.h>
+#include <sqlpp23/core/database/execute_many.h>
+#include <sqlpp23/core/database/serialization_cache.h>
 #include <sqlpp23/core/database/transaction.h>
+#include <sqlpp23/core/query/lazy_row.h>
+#include <sqlpp23/core/query/select_into.h>
 #include <sqlpp23/core/query/statement_handler.h>
 #include <sqlpp23/core/to_sql_string.h>
 #include <sqlpp23/core/type_traits.h>
@@ -55,11 +60,13 @@ namespace sqlpp::sqlite3 {
 namespace detail {
 inline prepared_statement_t prepare_statement(connection_handle& handle,
                                               std::string_view statement) {
+  handle.start_deadline();
   return prepared_statement_t{handle.native_handle(), statement,
                               handle.config.get()};
 }
 inline void execute_statement(connection_handle& handle,
                               prepared_statement_t& prepared) {
+  handle.start_deadline();
   auto rc = sqlite3_step(prepared.native_handle());
   switch (rc) {
     case SQLITE_OK:
@@ -71,11 +78,29 @@ inline void execute_statement(connection_handle& handle,
         handle.debug().log(log_category::statement,
                            "sqlite3_step return code: {}", rc);
       }
+      if (rc == SQLITE_INTERRUPT) {
+        throw timeout_exception{sqlite3_errmsg(handle.native_handle()), rc};
+      }
       throw exception{sqlite3_errmsg(handle.native_handle()), rc};
   }
 }
 }  // namespace detail
 
+// Interrupts the statement that a connection is currently executing. Can be
+// used from any thread, e.g. by a watchdog, but must not outlive the
+// connection.
+class cancel_handle {
+ public:
+  explicit cancel_handle(::sqlite3* connection) : _connection{connection} {}
+
+  // The current statement throws timeout_exception. Does nothing if no
+  // statement is running.
+  void cancel() const { sqlite3_interrupt(_connection); }
+
+ private:
+  ::sqlite3* _connection;
+};
+
 struct command_result {
   uint64_t affected_rows;
 };
@@ -92,6 +117,7 @@ class connection_base : public sqlpp::connection {
   using _config_t = connection_config;
   using _config_ptr_t = std::shared_ptr<const connection_config>;
   using _handle_t = detail::connection_handle;
+  using _context_t = context_t;
 
   using _prepared_statement_t = prepared_statement_t;
 
@@ -99,6 +125,7 @@ class connection_base : public sqlpp::connection {
   friend sqlpp::statement_handler_t;
 
   bool _transaction_active{false};
+  sqlpp::detail::prepared_sql_t _prepared_sql;
 
   // direct execution
   command_result execute_impl(std::string_view statement) {
@@ -147,6 +174,7 @@ class connection_base : public sqlpp::connection {
 
   bind_result_t run_prepared_select_impl(
       prepared_statement_t& prepared_statement) {
+    _handle.start_deadline();
     return {native_handle(), prepared_statement._sqlite3_statement,
             prepared_statement.config};
   }
@@ -196,7 +224,7 @@ class connection_base : public sqlpp::connection {
   template <typename Select>
   _prepared_statement_t _prepare_select(const Select& s) {
     context_t context{this};
-    auto query = to_sql_string(context, s);
+    auto query = _prepared_sql(context, s);
     return prepare_impl(query);
   }
 
@@ -219,7 +247,7 @@ class connection_base : public sqlpp::connection {
   template <typename Insert>
   _prepared_statement_t _prepare_insert(const Insert& i) {
     context_t context{this};
-    auto query = to_sql_string(context, i);
+    auto query = _prepared_sql(context, i);
     return prepare_impl(query);
   }
 
@@ -242,7 +270,7 @@ class connection_base : public sqlpp::connection {
   template <typename Update>
   _prepared_statement_t _prepare_update(const Update& u) {
     context_t context{this};
-    auto query = to_sql_string(context, u);
+    auto query = _prepared_sql(context, u);
     return prepare_impl(query);
   }
 
@@ -265,7 +293,7 @@ class connection_base : public sqlpp::connection {
   template <typename Delete>
   _prepared_statement_t _prepare_delete_from(const Delete& r) {
     context_t context{this};
-    auto query = to_sql_string(context, r);
+    auto query = _prepared_sql(context, r);
     return prepare_impl(query);
   }
 
@@ -290,7 +318,7 @@ class connection_base : public sqlpp::connection {
   template <typename Execute>
   _prepared_statement_t _prepare_execute(const Execute& x) {
     context_t context{this};
-    auto query = to_sql_string(context, x);
+    auto query = _prepared_sql(context, x);
     return prepare_impl(query);
   }
 
@@ -327,6 +355,71 @@ class connection_base : public sqlpp::connection {
     return sqlpp::statement_handler_t{}.prepare(t, *this);
   }
 
+  //! Like prepare(t), but the serialized statement is memoized in `cache`,
+  //! keyed by the statement type and its sqlpp::dynamic_shape(). Values other
+  //! than parameters (e.g. `tab.id == 5`) are rejected at compile time.
+  template <typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto prepare(const T& t, sqlpp::serialization_cache& cache) {
+    sqlpp::serialization_cache_check_t<T>{}.verify();
+    return _prepared_sql.with_cache(cache, [&] { return prepare(t); });
+  }
+
+  //! Executes a prepared insert, update, delete or execute statement once per
+  //! element of `rows` (tuples of parameter values) within a transaction.
+  //! Returns the total number of affected rows.
+  template <typename PreparedStatement, typename Range>
+    requires(sqlpp::is_prepared_statement_v<PreparedStatement>)
+  size_t execute_many(PreparedStatement& prepared, const Range& rows) {
+    return sqlpp::detail::execute_many(*this, prepared, rows);
+  }
+
+  //! Like operator() for select statements, but reads each row directly into
+  //! a Struct, matching members and result columns by name. Requires C++26
+  //! reflection, see docs/select.md.
+  template <typename Struct, typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto select_into(const T& t) {
+    sqlpp::check_run_consistency(t).verify();
+    sqlpp::check_compatibility<context_t>(t).verify();
+    return sqlpp::detail::select_into<Struct>(t, *this);
+  }
+
+  template <typename Struct, typename T>
+    requires(sqlpp::is_prepared_statement_v<std::decay_t<T>>)
+  auto select_into(T&& t) {
+    return sqlpp::detail::select_into<Struct>(std::forward<T>(t), *this);
+  }
+
+  //! Like operator() for select statements, but reads fields only when they
+  //! are accessed, e.g. via `row.id()`. See docs/select.md.
+  template <typename T>
+    requires(sqlpp::is_statement_v<T>)
+  auto select_lazy(const T& t) {
+    sqlpp::check_run_consistency(t).verify();
+    sqlpp::check_compatibility<context_t>(t).verify();
+    return sqlpp::detail::select_lazy(t, *this);
+  }
+
+  template <typename T>
+    requires(sqlpp::is_prepared_statement_v<std::decay_t<T>>)
+  auto select_lazy(T&& t) {
+    return sqlpp::detail::select_lazy(std::forward<T>(t), *this);
+  }
+
+  //! Statements running longer than `timeout` are interrupted and throw
+  //! timeout_exception. For selects, this includes fetching the rows. 0
+  //! disables the timeout.
+  void set_statement_timeout(std::chrono::milliseconds timeout) {
+    _handle.set_statement_timeout(timeout);
+  }
+
+  //! Returns a handle that can interrupt statements of this connection from
+  //! other threads.
+  cancel_handle get_cancel_handle() const {
+    return cancel_handle{native_handle()};
+  }
+
   //! set the transaction isolation level for this connection
   void set_default_isolation_level(isolation_level level) {
     if (level == sqlpp::isolation_level::read_uncommitted) {
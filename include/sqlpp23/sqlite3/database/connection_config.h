@@ -27,6 +27,7 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
 #include <string>
 
 #include <sqlpp23/core/debug_logger.h>
@@ -69,5 +70,9 @@ struct connection_config {
   std::string password;
   debug_logger debug;  // not compared
   bool use_extended_result_codes = false;
+  // Statements running longer than this are interrupted and throw
+  // timeout_exception. 0 disables the timeout, see
+  // connection_base::set_statement_timeout().
+  std::chrono::milliseconds statement_timeout{0};  // not compared
 };
 }  // namespace sqlpp::sqlite3
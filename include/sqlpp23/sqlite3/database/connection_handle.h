@@ -28,6 +28,7 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
 #include <memory>
 
 #ifdef SQLPP_USE_SQLCIPHER
@@ -40,9 +41,27 @@
 #include <sqlpp23/sqlite3/database/exception.h>
 
 namespace sqlpp::sqlite3::detail {
+// Number of virtual machine instructions between deadline checks.
+inline constexpr int deadline_check_interval = 1000;
+
+struct statement_deadline {
+  std::chrono::milliseconds timeout{0};
+  std::chrono::steady_clock::time_point deadline;
+};
+
+// Progress handler, interrupts the current statement once it returns non-zero.
+inline int deadline_expired(void* data) {
+  const auto& deadline = *static_cast<const statement_deadline*>(data);
+  return std::chrono::steady_clock::now() > deadline.deadline;
+}
+
 struct connection_handle {
   std::shared_ptr<const connection_config> config;
   std::unique_ptr<::sqlite3, int (*)(::sqlite3*)> sqlite;
+  // Owned separately, since sqlite keeps a pointer to it while the handle
+  // might be moved.
+  std::unique_ptr<statement_deadline> _deadline =
+      std::make_unique<statement_deadline>();
 
   connection_handle()
       : config{}, sqlite{nullptr, sqlite3_close} {}
@@ -66,6 +85,10 @@ struct connection_handle {
       }
     }
 
+    if (config->statement_timeout.count() > 0) {
+      set_statement_timeout(config->statement_timeout);
+    }
+
 #ifdef SQLITE_HAS_CODEC
     if (conf->password.size() > 0) {
       int ret = sqlite3_key(native_handle(), conf->password.data(),
@@ -84,6 +107,24 @@ struct connection_handle {
 
   ::sqlite3* native_handle() const { return sqlite.get(); }
 
+  void set_statement_timeout(std::chrono::milliseconds timeout) {
+    _deadline->timeout = timeout;
+    if (timeout.count() > 0) {
+      sqlite3_progress_handler(native_handle(), deadline_check_interval,
+                               deadline_expired, _deadline.get());
+    } else {
+      sqlite3_progress_handler(native_handle(), 0, nullptr, nullptr);
+    }
+  }
+
+  // Starts the clock for the statement timeout, if any.
+  void start_deadline() {
+    if (_deadline->timeout.count() > 0) {
+      _deadline->deadline =
+          std::chrono::steady_clock::now() + _deadline->timeout;
+    }
+  }
+
   bool is_connected() const {
     // The connection is established in the constructor and the SQLite3 client
     // library doesn't seem to have a way to check passively if the connection
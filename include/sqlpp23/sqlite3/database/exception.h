@@ -44,4 +44,11 @@ class exception : public sqlpp::exception {
   // native error code
   auto error_code() const { return _error_code; }
 };
+
+// Thrown when a statement was interrupted (SQLITE_INTERRUPT), i.e. it exceeded
+// connection_config::statement_timeout or was canceled via a cancel_handle.
+class timeout_exception : public exception {
+ public:
+  using exception::exception;
+};
 }  // namespace sqlpp
@@ -29,6 +29,7 @@
 
 #include <chrono>
 #include <cmath>
+#include <format>
 #include <memory>
 #include <string>
 #include <vector>
@@ -172,20 +173,25 @@ class prepared_statement_t {
   }
 
   void bind_parameter(size_t parameter_index, const std::chrono::microseconds& value) {
-   const auto text = std::format("{0:%H:%M:%S}", value);
+    // Formatted on the stack, sqlite3 copies the text.
+    char text[64];
+    const auto result =
+        std::format_to_n(text, sizeof(text), "{0:%H:%M:%S}", value);
     const int rc = sqlite3_bind_text(
-        _sqlite3_statement.get(), static_cast<int>(parameter_index + 1), text.data(),
-        static_cast<int>(text.size()), SQLITE_TRANSIENT);
+        _sqlite3_statement.get(), static_cast<int>(parameter_index + 1), text,
+        static_cast<int>(result.out - text), SQLITE_TRANSIENT);
     if (rc != SQLITE_OK) {
       throw exception{sqlite3_errmsg(_connection), rc};
     }
   }
 
   void bind_parameter(size_t parameter_index, const std::chrono::sys_days& value) {
-    const auto text = std::format("{0:%Y-%m-%d}", value);
+    char text[64];
+    const auto result =
+        std::format_to_n(text, sizeof(text), "{0:%Y-%m-%d}", value);
     const int rc = sqlite3_bind_text(
-        _sqlite3_statement.get(), static_cast<int>(parameter_index + 1), text.data(),
-        static_cast<int>(text.size()), SQLITE_TRANSIENT);
+        _sqlite3_statement.get(), static_cast<int>(parameter_index + 1), text,
+        static_cast<int>(result.out - text), SQLITE_TRANSIENT);
     if (rc != SQLITE_OK) {
       throw exception{sqlite3_errmsg(_connection), rc};
     }
@@ -193,10 +199,12 @@ class prepared_statement_t {
 
   void bind_parameter(size_t parameter_index,
                        const ::sqlpp::chrono::sys_microseconds& value) {
-    const auto text = std::format("{0:%Y-%m-%d %H:%M:%S}", value);
+    char text[64];
+    const auto result =
+        std::format_to_n(text, sizeof(text), "{0:%Y-%m-%d %H:%M:%S}", value);
     const int rc = sqlite3_bind_text(
-        _sqlite3_statement.get(), static_cast<int>(parameter_index + 1), text.data(),
-        static_cast<int>(text.size()), SQLITE_TRANSIENT);
+        _sqlite3_statement.get(), static_cast<int>(parameter_index + 1), text,
+        static_cast<int>(result.out - text), SQLITE_TRANSIENT);
     if (rc != SQLITE_OK) {
       throw exception{sqlite3_errmsg(_connection), rc};
     }
@@ -27,6 +27,7 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sqlpp23/core/basic/index_hint.h>
 #include <sqlpp23/core/basic/schema_qualified_table.h>
 #include <sqlpp23/core/clause/delete_from.h>
 #include <sqlpp23/core/clause/insert.h>
@@ -44,3 +45,4 @@
 #include <sqlpp23/core/name/common_aliases.h>
 #include <sqlpp23/core/name/create_name_tag.h>
 #include <sqlpp23/core/operator.h>
+#include <sqlpp23/core/query/to_vector.h>
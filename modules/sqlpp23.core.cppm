@@ -28,8 +28,18 @@
 module;
 
 #include <sqlpp23/sqlpp23.h>
+#include <sqlpp23/core/arrow/record_batch.h>
 #include <sqlpp23/core/database/connection_pool.h>
+#include <sqlpp23/core/database/parallel_scan.h>
+#include <sqlpp23/core/database/result_cache.h>
+#include <sqlpp23/core/database/serialization_cache.h>
+#include <sqlpp23/core/query/keyset.h>
+#include <sqlpp23/core/query/lazy_row.h>
+#include <sqlpp23/core/query/read_ahead.h>
+#include <sqlpp23/core/query/select_into.h>
+#include <sqlpp23/core/detail/hex.h>
 #include <sqlpp23/core/detail/parse_date_time.h>
+#include <sqlpp23/core/detail/parse_number.h>
 export module sqlpp23.core;
 
 export namespace sqlpp {
@@ -49,6 +59,9 @@ using ::sqlpp::left_outer_join;
 using ::sqlpp::right_outer_join;
 using ::sqlpp::full_outer_join;
 using ::sqlpp::cross_join;
+using ::sqlpp::array_parameter;
+using ::sqlpp::array_parameter_t;
+using ::sqlpp::array_parameter_value;
 using ::sqlpp::parameter;
 using ::sqlpp::parameter_t; // TODO remove?
 using ::sqlpp::parameter_value;
@@ -58,6 +71,12 @@ using ::sqlpp::verbatim_table;
 using ::sqlpp::parameterized_verbatim;
 using ::sqlpp::schema;
 using ::sqlpp::schema_qualified_table;
+using ::sqlpp::index_hint_t;
+using ::sqlpp::use_index;
+using ::sqlpp::force_index;
+using ::sqlpp::ignore_index;
+using ::sqlpp::indexed_by;
+using ::sqlpp::not_indexed;
 using ::sqlpp::star;
 using ::sqlpp::value;
 using ::sqlpp::no_value_t;
@@ -148,6 +167,8 @@ using ::sqlpp::default_value;
 using ::sqlpp::default_value_t;
 using ::sqlpp::delete_from;
 using ::sqlpp::for_update;
+using ::sqlpp::for_no_key_update;
+using ::sqlpp::for_share;
 using ::sqlpp::from;
 using ::sqlpp::group_by;
 using ::sqlpp::having;
@@ -209,6 +230,10 @@ using ::sqlpp::all;
 using ::sqlpp::all_t;
 using ::sqlpp::distinct;
 using ::sqlpp::distinct_t;
+using ::sqlpp::optimizer_hints;
+using ::sqlpp::optimizer_hints_t;
+using ::sqlpp::max_execution_time;
+using ::sqlpp::join_order;
 
 // aggregate functions
 using ::sqlpp::star;
@@ -219,6 +244,18 @@ using ::sqlpp::min;
 using ::sqlpp::sum;
 using ::sqlpp::over;
 
+// window functions
+using ::sqlpp::row_number;
+using ::sqlpp::rank;
+using ::sqlpp::dense_rank;
+using ::sqlpp::lag;
+using ::sqlpp::lead;
+using ::sqlpp::unbounded_preceding;
+using ::sqlpp::preceding;
+using ::sqlpp::current_row;
+using ::sqlpp::following;
+using ::sqlpp::unbounded_following;
+
 // functions
 using ::sqlpp::coalesce;
 using ::sqlpp::tuple_operand;
@@ -235,6 +272,8 @@ using ::sqlpp::upper;
 
 // database
 using ::sqlpp::bind_parameter;
+using ::sqlpp::check_array_parameter_size;
+using ::sqlpp::placeholder_count;
 using ::sqlpp::read_field;
 using ::sqlpp::bind_field;
 using ::sqlpp::isolation_level;
@@ -243,10 +282,30 @@ using ::sqlpp::exception;
 using ::sqlpp::connection_check;
 using ::sqlpp::normal_connection;
 using ::sqlpp::pooled_connection;
+using ::sqlpp::parallel_scan;
+using ::sqlpp::key_ranges;
+using ::sqlpp::key_range_t;
+using ::sqlpp::serialization_cache;
+using ::sqlpp::dynamic_shape;
+using ::sqlpp::result_cache;
+using ::sqlpp::result_cache_config;
+using ::sqlpp::cached_connection;
+using ::sqlpp::cached_rows_t;
 
 // query
 using ::sqlpp::dynamic;
 using ::sqlpp::dynamic_t;
+using ::sqlpp::to_vector;
+using ::sqlpp::read_ahead;
+using ::sqlpp::read_ahead_result_t;
+using ::sqlpp::into_row_t;
+using ::sqlpp::lazy_field_t;
+using ::sqlpp::lazy_row_t;
+using ::sqlpp::keyset;
+using ::sqlpp::keyset_t;
+using ::sqlpp::keyset_after_t;
+using ::sqlpp::keyset_pages;
+using ::sqlpp::keyset_pages_t;
 
 // serialization
 using ::sqlpp::to_sql_string;
@@ -281,6 +340,7 @@ using ::sqlpp::is_table;
 using ::sqlpp::is_text;
 using ::sqlpp::is_unsigned_integral;
 using ::sqlpp::make_parameter_list_t;
+using ::sqlpp::nulls_sort_first;
 using ::sqlpp::parameter_value_t;
 using ::sqlpp::have_correct_static_cte_dependencies;
 using ::sqlpp::parameters_of_t;
@@ -316,6 +376,8 @@ using ::sqlpp::is_date;
 using ::sqlpp::nodes_of_t;
 using ::sqlpp::select_column_has_name;
 using ::sqlpp::has_enabled_over;
+using ::sqlpp::is_window_function;
+using ::sqlpp::window_data_type_of;
 using ::sqlpp::has_enabled_comparison;
 using ::sqlpp::has_enabled_as;
 using ::sqlpp::has_enabled_join;
@@ -390,14 +452,19 @@ using ::sqlpp::statement_run_check_t;
 export namespace sqlpp::alias {
 using ::sqlpp::alias::avg_;
 using ::sqlpp::alias::count_;
+using ::sqlpp::alias::dense_rank_;
 using ::sqlpp::alias::distinct_avg_;
 using ::sqlpp::alias::distinct_count_;
 using ::sqlpp::alias::distinct_max_;
 using ::sqlpp::alias::distinct_min_;
 using ::sqlpp::alias::distinct_sum_;
 using ::sqlpp::alias::exists_;
+using ::sqlpp::alias::lag_;
+using ::sqlpp::alias::lead_;
 using ::sqlpp::alias::max_;
 using ::sqlpp::alias::min_;
+using ::sqlpp::alias::rank_;
+using ::sqlpp::alias::row_number_;
 using ::sqlpp::alias::sum_;
 
 using ::sqlpp::alias::a;
@@ -430,6 +497,20 @@ using ::sqlpp::alias::left;
 using ::sqlpp::alias::right;
 }
 
+export namespace sqlpp::arrow {
+using ::sqlpp::arrow::nullable_flag;
+using ::sqlpp::arrow::record_batch_builder;
+using ::sqlpp::arrow::export_schema;
+using ::sqlpp::arrow::export_record_batch;
+using ::sqlpp::arrow::export_stream;
+}
+
+export {
+using ::ArrowSchema;
+using ::ArrowArray;
+using ::ArrowArrayStream;
+}
+
 export namespace sqlpp::chrono {
 using ::sqlpp::chrono::sys_microseconds;
 }
@@ -437,7 +518,11 @@ using ::sqlpp::chrono::sys_microseconds;
 export namespace sqlpp::detail {
 // detail
 using ::sqlpp::detail::circular_buffer;
+using ::sqlpp::detail::hex_decode;
+using ::sqlpp::detail::hex_encode;
+using ::sqlpp::detail::hex_encode_scalar;
 using ::sqlpp::detail::parse_date;
+using ::sqlpp::detail::parse_number;
 using ::sqlpp::detail::parse_time;
 using ::sqlpp::detail::parse_timestamp;
 using ::sqlpp::detail::type_set;
@@ -43,16 +43,22 @@ using ::sqlpp::mysql::context_t;
 
 using ::sqlpp::mysql::command_result;
 using ::sqlpp::mysql::exception;
+using ::sqlpp::mysql::timeout_exception;
+using ::sqlpp::mysql::cancel_handle;
 
 using ::sqlpp::mysql::scoped_library_initializer_t;
 using ::sqlpp::mysql::global_library_init;
 
 using ::sqlpp::mysql::delete_from;
+using ::sqlpp::mysql::insert_into;
+using ::sqlpp::mysql::values;
 using ::sqlpp::mysql::update;
 
 using ::sqlpp::mysql::assert_no_bool_cast;
 using ::sqlpp::mysql::assert_no_full_outer_join_t;
 using ::sqlpp::mysql::assert_no_nulls_first_last;
+using ::sqlpp::mysql::assert_no_for_no_key_update;
+using ::sqlpp::mysql::assert_no_indexed_by;
 
 using ::sqlpp::mysql::to_sql_string;
 using ::sqlpp::mysql::quoted_name_to_sql_string;
@@ -48,9 +48,13 @@ using ::sqlpp::postgresql::update;
 
 using ::sqlpp::postgresql::connection_exception;
 using ::sqlpp::postgresql::result_exception;
+using ::sqlpp::postgresql::timeout_exception;
+using ::sqlpp::postgresql::cancel_handle;
 
 using ::sqlpp::postgresql::assert_no_cast_bool_to_numeric;
 using ::sqlpp::postgresql::assert_no_unsigned;
+using ::sqlpp::postgresql::assert_no_index_hints;
+using ::sqlpp::postgresql::assert_no_optimizer_hints;
 
 using ::sqlpp::postgresql::to_sql_string;
 using ::sqlpp::postgresql::data_type_to_sql_string;
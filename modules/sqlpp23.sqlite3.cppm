@@ -42,6 +42,8 @@ using ::sqlpp::sqlite3::context_t;
 
 using ::sqlpp::sqlite3::command_result;
 using ::sqlpp::sqlite3::exception;
+using ::sqlpp::sqlite3::timeout_exception;
+using ::sqlpp::sqlite3::cancel_handle;
 
 using ::sqlpp::sqlite3::delete_from;
 using ::sqlpp::sqlite3::update;
@@ -51,6 +53,9 @@ using ::sqlpp::sqlite3::insert_or_ignore;
 
 using ::sqlpp::sqlite3::assert_no_cast_to_date_time;
 using ::sqlpp::sqlite3::assert_no_any_t;
+using ::sqlpp::sqlite3::assert_no_for_update_t;
+using ::sqlpp::sqlite3::assert_no_mysql_index_hints_t;
+using ::sqlpp::sqlite3::assert_no_optimizer_hints_t;
 
 using ::sqlpp::sqlite3::to_sql_string;
 using ::sqlpp::sqlite3::nan_to_sql_string;
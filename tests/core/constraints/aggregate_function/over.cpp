@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/core/all.h>
+
+namespace {
+template <typename Expression>
+concept can_call_over_with =
+    requires(Expression expression) { sqlpp::over(expression); };
+
+template <typename Over, typename... Expressions>
+concept can_call_partition_by_with =
+    requires(Over o, Expressions... expressions) {
+      o.partition_by(expressions...);
+    };
+
+template <typename Over, typename... Expressions>
+concept can_call_order_by_with =
+    requires(Over o, Expressions... expressions) {
+      o.order_by(expressions...);
+    };
+
+template <typename Over, typename Start, typename End>
+concept can_call_rows_between_with =
+    requires(Over o, Start start, End end) { o.rows_between(start, end); };
+
+template <typename Over, typename Start, typename End>
+concept can_call_range_between_with =
+    requires(Over o, Start start, End end) { o.range_between(start, end); };
+
+template <typename Expression>
+concept can_call_lag_with =
+    requires(Expression expression) { sqlpp::lag(expression); };
+}  // namespace
+
+int main() {
+  auto foo = test::TabFoo{};
+
+  using Over = decltype(max(foo.id).over());
+
+  // over() requires an aggregate or window function
+  static_assert(can_call_over_with<decltype(max(foo.id))>);
+  static_assert(can_call_over_with<decltype(sqlpp::row_number())>);
+  static_assert(can_call_over_with<decltype(lag(foo.id))>);
+  static_assert(not can_call_over_with<decltype(foo.id)>);
+  static_assert(not can_call_over_with<decltype(foo.id + 1)>);
+
+  // Window functions have no value without over()
+  static_assert(not sqlpp::has_data_type_v<decltype(sqlpp::row_number())>);
+  static_assert(not sqlpp::has_data_type_v<decltype(sqlpp::rank())>);
+  static_assert(not sqlpp::has_data_type_v<decltype(sqlpp::dense_rank())>);
+  static_assert(sqlpp::has_data_type_v<decltype(sqlpp::rank().over())>);
+
+  // lag() and lead() require a value which is not an aggregate
+  static_assert(can_call_lag_with<decltype(foo.id)>);
+  static_assert(not can_call_lag_with<decltype(foo)>);
+  static_assert(not can_call_lag_with<decltype(max(foo.id))>);
+
+  // partition_by() requires at least one value
+  static_assert(can_call_partition_by_with<Over, decltype(foo.id)>);
+  static_assert(can_call_partition_by_with<Over, decltype(foo.id),
+                                           decltype(foo.textNnD)>);
+  static_assert(
+      can_call_partition_by_with<Over, decltype(dynamic(true, foo.id))>);
+  static_assert(not can_call_partition_by_with<Over>);
+  static_assert(not can_call_partition_by_with<Over, decltype(foo.id.asc())>);
+  static_assert(not can_call_partition_by_with<Over, decltype(foo)>);
+
+  // order_by() requires at least one sort order
+  static_assert(can_call_order_by_with<Over, decltype(foo.id.asc())>);
+  static_assert(
+      can_call_order_by_with<Over, decltype(dynamic(true, foo.id.asc()))>);
+  static_assert(not can_call_order_by_with<Over>);
+  static_assert(not can_call_order_by_with<Over, decltype(foo.id)>);
+
+  // Each part of the window specification can be set only once
+  using Partitioned = decltype(max(foo.id).over().partition_by(foo.id));
+  using Ordered = decltype(max(foo.id).over().order_by(foo.id.asc()));
+  using Framed = decltype(max(foo.id).over().rows_between(
+      sqlpp::unbounded_preceding, sqlpp::current_row));
+  static_assert(not can_call_partition_by_with<Partitioned, decltype(foo.id)>);
+  static_assert(can_call_order_by_with<Partitioned, decltype(foo.id.asc())>);
+  static_assert(not can_call_order_by_with<Ordered, decltype(foo.id.asc())>);
+  static_assert(can_call_partition_by_with<Ordered, decltype(foo.id)>);
+  static_assert(
+      not can_call_rows_between_with<Framed, sqlpp::unbounded_preceding_t,
+                                     sqlpp::current_row_t>);
+  static_assert(
+      not can_call_range_between_with<Framed, sqlpp::unbounded_preceding_t,
+                                      sqlpp::current_row_t>);
+
+  // Frames must not start after they end
+  static_assert(can_call_rows_between_with<Over, sqlpp::unbounded_preceding_t,
+                                           sqlpp::unbounded_following_t>);
+  static_assert(can_call_rows_between_with<Over, sqlpp::frame_preceding_t,
+                                           sqlpp::frame_following_t>);
+  static_assert(can_call_rows_between_with<Over, sqlpp::frame_preceding_t,
+                                           sqlpp::frame_preceding_t>);
+  static_assert(can_call_range_between_with<Over, sqlpp::current_row_t,
+                                            sqlpp::current_row_t>);
+  static_assert(not can_call_rows_between_with<Over, sqlpp::current_row_t,
+                                               sqlpp::frame_preceding_t>);
+  static_assert(
+      not can_call_rows_between_with<Over, sqlpp::unbounded_following_t,
+                                     sqlpp::unbounded_following_t>);
+  static_assert(
+      not can_call_range_between_with<Over, sqlpp::unbounded_preceding_t,
+                                      sqlpp::unbounded_preceding_t>);
+  static_assert(not can_call_rows_between_with<Over, int, int>);
+}
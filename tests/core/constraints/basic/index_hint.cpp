@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/core/all.h>
+
+namespace {
+SQLPP_CREATE_NAME_TAG(idx_foo);
+SQLPP_CREATE_NAME_TAG(idx_bar);
+
+template <typename Table, typename... Indexes>
+concept can_call_use_index_with =
+    requires(Table table, Indexes... indexes) {
+      sqlpp::use_index(table, indexes...);
+    };
+
+template <typename Table, typename... Indexes>
+concept can_call_indexed_by_with =
+    requires(Table table, Indexes... indexes) {
+      sqlpp::indexed_by(table, indexes...);
+    };
+
+template <typename Table>
+concept can_call_not_indexed_with =
+    requires(Table table) { sqlpp::not_indexed(table); };
+}  // namespace
+
+int main() {
+  const auto foo = test::TabFoo{};
+  const auto bar = test::TabBar{};
+
+  using Foo = decltype(foo);
+  using AFoo = decltype(foo.as(sqlpp::alias::a));
+  using IdxFoo = decltype(idx_foo);
+  using IdxBar = decltype(idx_bar);
+
+  // Index hints can be attached to tables and table aliases.
+  static_assert(can_call_use_index_with<Foo, IdxFoo>);
+  static_assert(can_call_use_index_with<Foo, IdxFoo, IdxBar>);
+  static_assert(can_call_use_index_with<AFoo, IdxFoo>);
+  static_assert(can_call_indexed_by_with<Foo, IdxFoo>);
+  static_assert(can_call_indexed_by_with<AFoo, IdxFoo>);
+  static_assert(can_call_not_indexed_with<Foo>);
+  static_assert(can_call_not_indexed_with<AFoo>);
+
+  // Index hints cannot be attached to joins or tables with index hints.
+  using Join = decltype(foo.join(bar).on(foo.id == bar.id));
+  using Hinted = decltype(sqlpp::use_index(foo, idx_foo));
+  static_assert(not can_call_use_index_with<Join, IdxFoo>);
+  static_assert(not can_call_use_index_with<Hinted, IdxBar>);
+  static_assert(not can_call_indexed_by_with<Join, IdxFoo>);
+  static_assert(not can_call_not_indexed_with<Join>);
+  static_assert(not can_call_not_indexed_with<Hinted>);
+
+  // use_index requires at least one index, indexed_by exactly one.
+  static_assert(not can_call_use_index_with<Foo>);
+  static_assert(not can_call_use_index_with<Foo, int>);
+  static_assert(not can_call_indexed_by_with<Foo>);
+  static_assert(not can_call_indexed_by_with<Foo, IdxFoo, IdxBar>);
+
+  // Tables with index hints can be joined.
+  static_assert(sqlpp::is_table<Hinted>::value);
+  std::ignore = sqlpp::use_index(foo, idx_foo).join(bar).on(foo.id == bar.id);
+}
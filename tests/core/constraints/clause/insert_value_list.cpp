@@ -74,6 +74,16 @@ template <typename Statement, typename... Expressions>
 concept cannot_call_add_values_with =
     not can_call_add_values_with<Statement, Expressions...>;
 
+template <typename Statement, typename Select>
+concept can_call_insert_select_with =
+    requires(Statement statement, Select sub_select) {
+      statement.select(sub_select);
+    };
+
+template <typename Statement, typename Select>
+concept cannot_call_insert_select_with =
+    not can_call_insert_select_with<Statement, Select>;
+
 }  // namespace
 
 int main() {
@@ -231,4 +241,58 @@ int main() {
                                     decltype(bar.boolNn = bar.boolNn)>);
   }
 
+  // -------------------------
+  // insert_into(tab).columns(...).select(...)
+  // -------------------------
+  {
+    auto i = insert_into(bar).columns(bar.intN, bar.boolNn);
+    using I = decltype(i);
+    const auto big = (foo.id > 7).as(sqlpp::alias::a);
+
+    // OK, result fields can be assigned to the columns
+    static_assert(can_call_insert_select_with<
+                  I, decltype(select(foo.intN, big).from(foo).where(true))>);
+    static_assert(can_call_insert_select_with<
+                  I, decltype(select(foo.id,
+                                     foo.boolN.is_null().as(sqlpp::alias::a))
+                                  .from(foo)
+                                  .where(true))>);
+
+    // Not OK, not a select
+    static_assert(cannot_call_insert_select_with<I, decltype(foo.intN)>);
+    static_assert(cannot_call_insert_select_with<
+                  I, decltype(update(foo).set(foo.intN = 7).where(true))>);
+
+    // Not OK, wrong number of result fields
+    static_assert(cannot_call_insert_select_with<
+                  I, decltype(select(foo.intN).from(foo).where(true))>);
+    static_assert(cannot_call_insert_select_with<
+                  I, decltype(select(foo.intN, big, foo.doubleN)
+                                  .from(foo)
+                                  .where(true))>);
+
+    // Not OK, wrong data types
+    static_assert(cannot_call_insert_select_with<
+                  I, decltype(select(foo.textNnD, big).from(foo).where(true))>);
+
+    // Not OK, nullable result field for non-nullable column
+    static_assert(cannot_call_insert_select_with<
+                  I, decltype(select(foo.intN, foo.boolN).from(foo).where(
+                         true))>);
+
+    // The select needs to be consistent itself.
+    {
+      auto s = i.select(select(foo.intN, big).from(foo).where(true));
+      static_assert(
+          std::is_same<sqlpp::statement_consistency_check_t<decltype(s)>,
+                       sqlpp::consistent_t>::value);
+    }
+    {
+      auto s = i.select(select(foo.intN, big));
+      static_assert(
+          not std::is_same<sqlpp::statement_consistency_check_t<decltype(s)>,
+                           sqlpp::consistent_t>::value);
+    }
+  }
+
 }
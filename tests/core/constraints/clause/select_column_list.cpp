@@ -112,6 +112,39 @@ int main() {
   static_assert(cannot_call_select_columns_with<sqlpp::union_all_t, decltype(bar.id)>,
                 "Not OK, incorrect flag");
 
+  // select_columns(<misplaced optimizer hints>) cannot be called.
+  using Hints =
+      decltype(sqlpp::optimizer_hints(sqlpp::max_execution_time({})));
+  static_assert(can_call_select_columns_with<Hints, decltype(bar.id)>,
+                "OK, optimizer hints as first flag");
+  static_assert(
+      can_call_select_columns_with<Hints, sqlpp::distinct_t, decltype(bar.id)>,
+      "OK, optimizer hints as first flag");
+  static_assert(
+      cannot_call_select_columns_with<sqlpp::distinct_t, Hints, decltype(bar.id)>,
+      "Not OK, optimizer hints must be the first flag");
+
+  // join_order() must only name tables that are provided by the statement.
+  {
+    auto s = select(sqlpp::optimizer_hints(sqlpp::join_order(bar, foo)),
+                    foo.id)
+                 .from(foo.cross_join(bar));
+    using S = decltype(s);
+    static_assert(std::is_same<sqlpp::statement_consistency_check_t<S>,
+                               sqlpp::consistent_t>::value,
+                  "");
+  }
+  {
+    auto s = select(sqlpp::optimizer_hints(sqlpp::join_order(bar, foo)),
+                    foo.id)
+                 .from(foo);
+    using S = decltype(s);
+    static_assert(
+        std::is_same<sqlpp::statement_consistency_check_t<S>,
+                     sqlpp::assert_join_order_tables_provided_t>::value,
+        "");
+  }
+
   // select_columns(<at least one unnamed column>) is inconsistent and cannot be
   // constructed.
   static_assert(cannot_call_select_columns_with<decltype(sqlpp::value(7))>,
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/core/all.h>
+
+#if SQLPP_INCLUDE_REFLECTION == 1
+namespace {
+struct Bar {
+  int64_t id;                        // matched by C++ and SQL name
+  bool bool_nn;                      // matched by SQL name
+  std::optional<std::string> textN;  // matched by C++ name
+  std::string comment = "unmapped";
+};
+
+// Can be read row by row, but not collected via to_vector().
+struct BarView {
+  int64_t id;
+  std::optional<std::string_view> textN;
+};
+static_assert(not sqlpp::detail::has_non_owning_member<Bar>());
+static_assert(sqlpp::detail::has_non_owning_member<BarView>());
+}  // namespace
+#endif
+
+int main(int, char*[]) {
+#if SQLPP_INCLUDE_REFLECTION == 1
+  const auto bar = test::TabBar{};
+
+  sqlpp::mock_db::connection db = sqlpp::mock_db::make_test_connection();
+  db._mock_result_data.rows = {{"1", "t", "cheese"}, {"2", "f", std::nullopt}};
+
+  const auto query = select(bar.id, bar.boolNn, bar.textN).from(bar);
+
+  {
+    int64_t expected_id = 0;
+    for (const Bar& row : db.select_into<Bar>(query)) {
+      ++expected_id;
+      assert(row.id == expected_id);
+      assert(row.comment == "unmapped");
+    }
+    assert(expected_id == 2);
+  }
+
+  {
+    const auto rows = sqlpp::to_vector(db.select_into<Bar>(query));
+    assert(rows.size() == 2);
+    assert(rows[0].id == 1);
+    assert(rows[0].bool_nn);
+    assert(rows[0].textN == "cheese");
+    assert(rows[1].id == 2);
+    assert(not rows[1].bool_nn);
+    assert(not rows[1].textN.has_value());
+  }
+
+  {
+    auto prepared =
+        db.prepare(query.where(bar.id > sqlpp::parameter(bar.id)));
+    prepared.parameters.id = 0;
+    const auto rows = sqlpp::to_vector(db.select_into<Bar>(prepared));
+    assert(rows.size() == 2);
+  }
+#endif
+
+  return 0;
+}
@@ -42,5 +42,73 @@ int main(int, char*[]) {
   SQLPP_COMPARE(sum(foo.doubleN).over().as(cheese),
                 "SUM(tab_foo.double_n) OVER() AS cheese");
 
+  // Window specification
+  SQLPP_COMPARE(sum(foo.doubleN).over().partition_by(foo.textNnD).as(cheese),
+                "SUM(tab_foo.double_n) OVER(PARTITION BY tab_foo.text_nn_d) "
+                "AS cheese");
+  SQLPP_COMPARE(
+      sum(foo.doubleN).over().partition_by(foo.textNnD, foo.boolN).as(cheese),
+      "SUM(tab_foo.double_n) OVER(PARTITION BY tab_foo.text_nn_d, "
+      "tab_foo.bool_n) AS cheese");
+  SQLPP_COMPARE(sum(foo.doubleN).over().order_by(foo.id.asc()).as(cheese),
+                "SUM(tab_foo.double_n) OVER(ORDER BY tab_foo.id ASC) AS cheese");
+  SQLPP_COMPARE(sum(foo.doubleN)
+                    .over()
+                    .partition_by(foo.textNnD)
+                    .order_by(foo.id.asc(), foo.intN.desc())
+                    .as(cheese),
+                "SUM(tab_foo.double_n) OVER(PARTITION BY tab_foo.text_nn_d "
+                "ORDER BY tab_foo.id ASC, tab_foo.int_n DESC) AS cheese");
+  SQLPP_COMPARE(
+      sum(foo.doubleN)
+          .over()
+          .order_by(foo.id.asc())
+          .rows_between(sqlpp::unbounded_preceding, sqlpp::current_row)
+          .as(cheese),
+      "SUM(tab_foo.double_n) OVER(ORDER BY tab_foo.id ASC ROWS BETWEEN "
+      "UNBOUNDED PRECEDING AND CURRENT ROW) AS cheese");
+  SQLPP_COMPARE(
+      avg(foo.doubleN)
+          .over()
+          .order_by(foo.id.asc())
+          .rows_between(sqlpp::preceding(2), sqlpp::following(3))
+          .as(cheese),
+      "AVG(tab_foo.double_n) OVER(ORDER BY tab_foo.id ASC ROWS BETWEEN 2 "
+      "PRECEDING AND 3 FOLLOWING) AS cheese");
+  SQLPP_COMPARE(
+      max(foo.doubleN)
+          .over()
+          .range_between(sqlpp::current_row, sqlpp::unbounded_following)
+          .as(cheese),
+      "MAX(tab_foo.double_n) OVER(RANGE BETWEEN CURRENT ROW AND UNBOUNDED "
+      "FOLLOWING) AS cheese");
+
+  // Dynamic parts of the window specification
+  SQLPP_COMPARE(sum(foo.doubleN)
+                    .over()
+                    .partition_by(dynamic(false, foo.textNnD))
+                    .order_by(dynamic(true, foo.id.asc()))
+                    .as(cheese),
+                "SUM(tab_foo.double_n) OVER(ORDER BY tab_foo.id ASC) AS cheese");
+
+  // Window functions
+  SQLPP_COMPARE(sqlpp::row_number().over().order_by(foo.id.asc()).as(cheese),
+                "ROW_NUMBER() OVER(ORDER BY tab_foo.id ASC) AS cheese");
+  SQLPP_COMPARE(sqlpp::rank()
+                    .over()
+                    .partition_by(foo.textNnD)
+                    .order_by(foo.intN.desc())
+                    .as(cheese),
+                "RANK() OVER(PARTITION BY tab_foo.text_nn_d ORDER BY "
+                "tab_foo.int_n DESC) AS cheese");
+  SQLPP_COMPARE(sqlpp::dense_rank().over().order_by(foo.intN.desc()).as(cheese),
+                "DENSE_RANK() OVER(ORDER BY tab_foo.int_n DESC) AS cheese");
+  SQLPP_COMPARE(lag(foo.doubleN).over().order_by(foo.id.asc()).as(cheese),
+                "LAG(tab_foo.double_n, 1) OVER(ORDER BY tab_foo.id ASC) AS "
+                "cheese");
+  SQLPP_COMPARE(lead(foo.doubleN, 2).over().order_by(foo.id.asc()).as(cheese),
+                "LEAD(tab_foo.double_n, 2) OVER(ORDER BY tab_foo.id ASC) AS "
+                "cheese");
+
   return 0;
 }
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/core/all.h>
+
+SQLPP_CREATE_NAME_TAG(idx_foo);
+SQLPP_CREATE_NAME_TAG(idx_bar);
+
+int main(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  const auto bar = test::TabBar{};
+  const auto aFoo = foo.as(sqlpp::alias::a);
+
+  // MySQL index hints
+  SQLPP_COMPARE(use_index(foo, idx_foo), "tab_foo USE INDEX (idx_foo)");
+  SQLPP_COMPARE(force_index(foo, idx_foo, idx_bar),
+                "tab_foo FORCE INDEX (idx_foo, idx_bar)");
+  SQLPP_COMPARE(ignore_index(aFoo, idx_foo),
+                "tab_foo AS a IGNORE INDEX (idx_foo)");
+
+  // SQLite index hints
+  SQLPP_COMPARE(indexed_by(foo, idx_foo), "tab_foo INDEXED BY idx_foo");
+  SQLPP_COMPARE(indexed_by(aFoo, idx_foo), "tab_foo AS a INDEXED BY idx_foo");
+  SQLPP_COMPARE(not_indexed(foo), "tab_foo NOT INDEXED");
+
+  // Hinted tables provide the original table.
+  static_assert(
+      std::is_same<
+          sqlpp::provided_tables_of_t<decltype(use_index(foo, idx_foo))>,
+          sqlpp::detail::type_set<test::TabFoo>>::value,
+      "");
+
+  // Index hints in FROM and JOIN
+  SQLPP_COMPARE(select(foo.id).from(use_index(foo, idx_foo)),
+                "SELECT tab_foo.id FROM tab_foo USE INDEX (idx_foo)");
+  SQLPP_COMPARE(
+      select(foo.id, bar.id)
+          .from(not_indexed(foo).join(indexed_by(bar, idx_bar))
+                    .on(foo.id == bar.id)),
+      "SELECT tab_foo.id, tab_bar.id FROM tab_foo NOT INDEXED INNER JOIN "
+      "tab_bar INDEXED BY idx_bar ON tab_foo.id = tab_bar.id");
+
+  return 0;
+}
@@ -44,5 +44,14 @@ int main(int, char*[]) {
           foo.intN = parameter(foo.intN), foo.textNnD = parameter(foo.textNnD)),
       " ON CONFLICT (id) DO UPDATE SET int_n = ?, text_nn_d = ?");
 
+  // Array parameters use one placeholder per value in IN lists.
+  SQLPP_COMPARE(foo.id.in(sqlpp::array_parameter<3>(foo.id)),
+                "tab_foo.id IN (?, ?, ?)");
+  SQLPP_COMPARE(foo.id.not_in(sqlpp::array_parameter<1>(foo.id)),
+                "tab_foo.id NOT IN (?)");
+  SQLPP_COMPARE(
+      foo.textNnD.in(sqlpp::array_parameter<2>(sqlpp::text{}, something)),
+      "tab_foo.text_nn_d IN (?, ?)");
+
   return 0;
 }
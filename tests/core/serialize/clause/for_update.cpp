@@ -29,6 +29,26 @@
 int main(int, char*[]) {
   // No parameters.
   SQLPP_COMPARE(sqlpp::for_update(), " FOR UPDATE");
+  SQLPP_COMPARE(sqlpp::for_no_key_update(), " FOR NO KEY UPDATE");
+  SQLPP_COMPARE(sqlpp::for_share(), " FOR SHARE");
+
+  // Not waiting for locked rows.
+  SQLPP_COMPARE(sqlpp::for_update().nowait(), " FOR UPDATE NOWAIT");
+  SQLPP_COMPARE(sqlpp::for_update().skip_locked(), " FOR UPDATE SKIP LOCKED");
+  SQLPP_COMPARE(sqlpp::for_no_key_update().skip_locked(),
+                " FOR NO KEY UPDATE SKIP LOCKED");
+  SQLPP_COMPARE(sqlpp::for_share().nowait(), " FOR SHARE NOWAIT");
+
+  // Within a select.
+  const auto foo = test::TabFoo{};
+  SQLPP_COMPARE(select(foo.id)
+                    .from(foo)
+                    .where(foo.boolN.is_null())
+                    .limit(10u)
+                    .for_update()
+                    .skip_locked(),
+                "SELECT tab_foo.id FROM tab_foo WHERE tab_foo.bool_n IS NULL "
+                "LIMIT 10 FOR UPDATE SKIP LOCKED");
 
   return 0;
 }
@@ -53,5 +53,26 @@ int main(int, char*[]) {
                   "(DEFAULT, DEFAULT, 'cheese'), (17, NULL, 'cake')");
   }
 
+  // Rows of a select.
+  {
+    const auto bar = test::TabBar{};
+    SQLPP_COMPARE(insert_into(foo)
+                      .columns(foo.intN, foo.boolN, foo.textNnD)
+                      .select(select(bar.intN, bar.boolNn,
+                                     sqlpp::value("cake").as(sqlpp::alias::a))
+                                  .from(bar)
+                                  .where(bar.id > 17)),
+                  "INSERT INTO tab_foo (int_n, bool_n, text_nn_d) SELECT "
+                  "tab_bar.int_n, tab_bar.bool_nn, 'cake' AS a FROM "
+                  "tab_bar WHERE tab_bar.id > 17");
+
+    // Values added before are dropped.
+    auto i = insert_into(foo).columns(foo.intN);
+    i.add_values(foo.intN = 17);
+    SQLPP_COMPARE(i.select(select(bar.intN).from(bar).where(true)),
+                  "INSERT INTO tab_foo (int_n) SELECT tab_bar.int_n FROM "
+                  "tab_bar WHERE 1");
+  }
+
   return 0;
 }
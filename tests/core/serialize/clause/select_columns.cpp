@@ -49,6 +49,24 @@ int main(int, char*[]) {
   SQLPP_COMPARE(select(sqlpp::all, dynamic(false, sqlpp::distinct), foo.doubleN), "SELECT ALL tab_foo.double_n");
   SQLPP_COMPARE(select(sqlpp::all, dynamic(true, sqlpp::distinct), foo.doubleN), "SELECT ALL DISTINCT tab_foo.double_n");
 
+  // Optimizer hints
+  SQLPP_COMPARE(
+      select(sqlpp::optimizer_hints(sqlpp::max_execution_time(
+                 std::chrono::milliseconds{1000})),
+             foo.doubleN),
+      "SELECT /*+ MAX_EXECUTION_TIME(1000) */ tab_foo.double_n");
+  SQLPP_COMPARE(
+      select(sqlpp::optimizer_hints(sqlpp::join_order(bar, foo),
+                                    sqlpp::max_execution_time(
+                                        std::chrono::milliseconds{50})),
+             sqlpp::distinct, foo.doubleN),
+      "SELECT /*+ JOIN_ORDER(tab_bar, tab_foo) MAX_EXECUTION_TIME(50) */ "
+      "DISTINCT tab_foo.double_n");
+  SQLPP_COMPARE(select(dynamic(false, sqlpp::optimizer_hints(
+                                         sqlpp::join_order(bar, foo))),
+                       foo.doubleN),
+                "SELECT tab_foo.double_n");
+
   // Two columns
   SQLPP_COMPARE(select(foo.doubleN, bar.id),
                 "SELECT tab_foo.double_n, tab_bar.id");
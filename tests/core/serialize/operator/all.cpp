@@ -24,6 +24,8 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <memory_resource>
+
 #include <sqlpp23/tests/core/all.h>
 
 SQLPP_CREATE_NAME_TAG(v);
@@ -307,6 +309,15 @@ int main(int, char*[]) {
     SQLPP_COMPARE(val.not_in(std::vector<expr_t>{expr, expr, expr}),
                   "17 NOT IN ((17 + 4), (17 + 4), (17 + 4))");
 
+    // Vectors with other allocators, e.g. from a per-request arena.
+    {
+      std::pmr::monotonic_buffer_resource arena;
+      SQLPP_COMPARE(val.in(std::pmr::vector<int>({17, 18, 19}, &arena)),
+                    "17 IN (17, 18, 19)");
+      SQLPP_COMPARE(val.not_in(std::pmr::vector<int>({17, 18}, &arena)),
+                    "17 NOT IN (17, 18)");
+    }
+
     // IN expressions with no arguments are an error in SQL. No magic
     // protection.
     SQLPP_COMPARE(val.in(std::vector<expr_t>{}), "17 IN ()");
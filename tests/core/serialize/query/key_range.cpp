@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/core/database/parallel_scan.h>
+#include <sqlpp23/tests/core/all.h>
+
+int main(int, char*[]) {
+  const auto foo = test::TabFoo{};
+
+  // No split points: the whole table.
+  {
+    const auto ranges = sqlpp::key_ranges(foo.id, std::vector<int64_t>{});
+    assert(ranges.size() == 1);
+    SQLPP_COMPARE(ranges[0], "1");
+  }
+
+  // Split points are sorted and deduplicated.
+  {
+    const auto ranges =
+        sqlpp::key_ranges(foo.id, std::vector<int64_t>{200, 100, 200});
+    assert(ranges.size() == 3);
+    SQLPP_COMPARE(ranges[0], "(tab_foo.id < 100)");
+    SQLPP_COMPARE(ranges[1], "(tab_foo.id >= 100 AND tab_foo.id < 200)");
+    SQLPP_COMPARE(ranges[2], "(tab_foo.id >= 200)");
+  }
+
+  // Text keys.
+  {
+    const auto ranges =
+        sqlpp::key_ranges(foo.textNnD, std::vector<std::string>{"m"});
+    SQLPP_COMPARE(ranges[0], "(tab_foo.text_nn_d < 'm')");
+    SQLPP_COMPARE(ranges[1], "(tab_foo.text_nn_d >= 'm')");
+  }
+
+  // Within a statement.
+  SQLPP_COMPARE(
+      select(foo.id)
+          .from(foo)
+          .where(foo.boolN.is_null() and
+                 sqlpp::key_ranges(foo.id, std::vector<int64_t>{7})[1]),
+      "SELECT tab_foo.id FROM tab_foo WHERE (tab_foo.bool_n IS NULL) AND "
+      "(tab_foo.id >= 7)");
+
+  // Equal-width split points.
+  assert((sqlpp::detail::equal_width_split_points(1, 100, 4) ==
+          std::vector<int64_t>{25, 50, 75}));
+  assert((sqlpp::detail::equal_width_split_points(1, 3, 8) ==
+          std::vector<int64_t>{2}));
+  assert(sqlpp::detail::equal_width_split_points(5, 5, 4).empty());
+  assert(sqlpp::detail::equal_width_split_points(1, 100, 1).empty());
+
+  return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/core/query/keyset.h>
+#include <sqlpp23/tests/core/all.h>
+
+int main(int, char*[]) {
+  const auto foo = test::TabFoo{};
+
+  // Single key.
+  SQLPP_COMPARE(sqlpp::keyset(foo.id.asc()).after(17), "(tab_foo.id > 17)");
+  SQLPP_COMPARE(sqlpp::keyset(foo.id.desc()).after(17), "(tab_foo.id < 17)");
+
+  // Multiple keys, mixed directions.
+  SQLPP_COMPARE(
+      sqlpp::keyset(foo.textNnD.asc(), foo.id.desc()).after("cake", 17),
+      "(tab_foo.text_nn_d >= 'cake' AND (tab_foo.text_nn_d > 'cake' OR "
+      "tab_foo.id < 17))");
+  SQLPP_COMPARE(
+      sqlpp::keyset(foo.textNnD.desc(), foo.doubleN.asc(), foo.id.asc())
+          .after("cake", 1.5, 17),
+      "(tab_foo.text_nn_d <= 'cake' AND (tab_foo.text_nn_d < 'cake' OR "
+      "(tab_foo.double_n >= 1.5 AND (tab_foo.double_n > 1.5 OR "
+      "tab_foo.id > 17))))");
+
+  // Nullable keys, NULL sorts first by default.
+  SQLPP_COMPARE(sqlpp::keyset(foo.intN.asc(), foo.id.asc())
+                    .after(std::optional<int64_t>{5}, 17),
+                "(tab_foo.int_n >= 5 AND (tab_foo.int_n > 5 OR "
+                "tab_foo.id > 17))");
+  SQLPP_COMPARE(sqlpp::keyset(foo.intN.asc(), foo.id.asc())
+                    .after(std::optional<int64_t>{}, 17),
+                "(tab_foo.int_n IS NOT NULL OR tab_foo.id > 17)");
+  SQLPP_COMPARE(sqlpp::keyset(foo.intN.desc(), foo.id.asc())
+                    .after(std::optional<int64_t>{5}, 17),
+                "((tab_foo.int_n <= 5 OR tab_foo.int_n IS NULL) AND "
+                "((tab_foo.int_n < 5 OR tab_foo.int_n IS NULL) OR "
+                "tab_foo.id > 17))");
+
+  // Nullable keys with explicit NULL position.
+  SQLPP_COMPARE(sqlpp::keyset(foo.intN.asc().nulls_last(), foo.id.asc())
+                    .after(std::optional<int64_t>{5}, 17),
+                "((tab_foo.int_n >= 5 OR tab_foo.int_n IS NULL) AND "
+                "((tab_foo.int_n > 5 OR tab_foo.int_n IS NULL) OR "
+                "tab_foo.id > 17))");
+  SQLPP_COMPARE(sqlpp::keyset(foo.intN.asc().nulls_last(), foo.id.asc())
+                    .after(std::optional<int64_t>{}, 17),
+                "(tab_foo.int_n IS NULL AND tab_foo.id > 17)");
+  SQLPP_COMPARE(sqlpp::keyset(foo.intN.asc().nulls_last())
+                    .after(std::optional<int64_t>{}),
+                "0");
+  SQLPP_COMPARE(sqlpp::keyset(foo.intN.desc().nulls_first())
+                    .after(std::optional<int64_t>{}),
+                "(tab_foo.int_n IS NOT NULL)");
+
+  // Parameters, as used by keyset_pages().
+  {
+    const auto after = sqlpp::keyset(foo.textNnD.asc(), foo.id.desc())
+                           .after_parameters();
+    static_assert(sqlpp::parameters_of_t<decltype(after)>::size() == 3);
+    SQLPP_COMPARE(after,
+                  "(tab_foo.text_nn_d >= ? AND (tab_foo.text_nn_d > ? OR "
+                  "tab_foo.id < ?))");
+  }
+
+  // Within a statement.
+  {
+    const auto keys = sqlpp::keyset(foo.textNnD.asc(), foo.id.asc());
+    SQLPP_COMPARE(
+        keys.order_by(select(foo.id)
+                          .from(foo)
+                          .where(foo.boolN.is_null() and keys.after("a", 7)))
+            .limit(10u),
+        "SELECT tab_foo.id FROM tab_foo WHERE (tab_foo.bool_n IS NULL) AND "
+        "(tab_foo.text_nn_d >= 'a' AND (tab_foo.text_nn_d > 'a' OR "
+        "tab_foo.id > 7)) ORDER BY tab_foo.text_nn_d ASC, tab_foo.id ASC "
+        "LIMIT 10");
+  }
+
+  return 0;
+}
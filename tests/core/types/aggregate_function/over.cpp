@@ -108,6 +108,39 @@ void test_aggregate_functions(Value v) {
       std::is_same<sqlpp::nodes_of_t<decltype(min(v_not_null).over())>,
                    sqlpp::detail::type_vector<L>>::value,
       "");
+
+  // Window specifications add their expressions as nodes
+  static_assert(
+      std::is_same<
+          sqlpp::nodes_of_t<decltype(max(v_not_null)
+                                         .over()
+                                         .partition_by(v_maybe_null)
+                                         .order_by(v_not_null.asc()))>,
+          sqlpp::detail::type_vector<
+              L, std::decay_t<decltype(v_maybe_null)>,
+              std::decay_t<decltype(v_not_null.asc())>>>::value,
+      "");
+
+  // Window specifications do not change the data type
+  static_assert(
+      is_same_type<decltype(max(v_not_null)
+                                .over()
+                                .order_by(v_not_null.asc())
+                                .rows_between(sqlpp::unbounded_preceding,
+                                              sqlpp::current_row)),
+                   OptDataType>::value,
+      "");
+
+  // Window functions have a value only with over()
+  static_assert(not sqlpp::has_data_type_v<decltype(lag(v_not_null))>, "");
+  static_assert(not sqlpp::has_data_type_v<decltype(lead(v_not_null))>, "");
+
+  // LAG and LEAD might not find a row
+  static_assert(
+      is_same_type<decltype(lag(v_not_null).over()), OptDataType>::value, "");
+  static_assert(
+      is_same_type<decltype(lead(v_maybe_null, 2).over()), OptDataType>::value,
+      "");
 }
 
 template <typename Value>
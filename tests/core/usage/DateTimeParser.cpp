@@ -342,6 +342,55 @@ void test_timestamp_with_trailing_characters() {
   }
 }
 
+void test_length_aware_input() {
+  using namespace sqlpp::chrono;
+
+  // The input does not need to be null-terminated, parsing stops at the end
+  // of the view.
+  const char* buffer = "2024-05-06 07:08:09.123456+01XYZ";
+  {
+    auto input = std::string_view{buffer, 29};
+    ::sqlpp::chrono::sys_microseconds tp;
+    if (not sqlpp::detail::parse_timestamp(tp, input) or not input.empty()) {
+      throw std::runtime_error{"Parse error"};
+    }
+    require_equal(__LINE__, tp,
+                  build_timestamp(2024, 5, 6, 7, 8, 9, 123456, true, 1));
+  }
+  {
+    auto input = std::string_view{buffer, 10};
+    std::chrono::sys_days dp;
+    if (not sqlpp::detail::parse_date(dp, input) or not input.empty()) {
+      throw std::runtime_error{"Parse error"};
+    }
+    require_equal(__LINE__, dp,
+                  std::chrono::sys_days{std::chrono::year{2024} / 5 / 6});
+  }
+  {
+    auto input = std::string_view{buffer + 11, 10};
+    std::chrono::microseconds us;
+    if (not sqlpp::detail::parse_time(us, input) or not input.empty()) {
+      throw std::runtime_error{"Parse error"};
+    }
+    require_equal(__LINE__, us, build_tod(7, 8, 9, 100000));
+  }
+  // Truncated views must not be read beyond their end
+  for (const auto length : {0, 3, 8, 9}) {
+    auto input = std::string_view{buffer, static_cast<size_t>(length)};
+    std::chrono::sys_days dp;
+    if (sqlpp::detail::parse_date(dp, input)) {
+      throw std::runtime_error{"Parsed truncated date"};
+    }
+  }
+  for (const auto length : {11, 15, 18}) {
+    auto input = std::string_view{buffer, static_cast<size_t>(length)};
+    ::sqlpp::chrono::sys_microseconds tp;
+    if (sqlpp::detail::parse_timestamp(tp, input)) {
+      throw std::runtime_error{"Parsed truncated timestamp"};
+    }
+  }
+}
+
 }  // namespace
 
 int DateTimeParser(int, char*[]) {
@@ -354,5 +403,6 @@ int DateTimeParser(int, char*[]) {
   test_valid_timestamp();
   test_invalid_timestamp();
   test_timestamp_with_trailing_characters();
+  test_length_aware_input();
   return 0;
 }
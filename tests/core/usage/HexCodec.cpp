@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+#include <vector>
+
+#include <sqlpp23/tests/core/all.h>
+
+namespace {
+void require(int line, bool condition) {
+  if (not condition) {
+    std::cerr << line << ": unexpected result" << std::endl;
+    throw std::runtime_error("Unexpected result");
+  }
+}
+
+std::string encode(const std::vector<uint8_t>& bytes) {
+  auto result = std::string(bytes.size() * 2, '\0');
+  sqlpp::detail::hex_encode(bytes.data(), bytes.size(), result.data());
+  return result;
+}
+
+std::string encode_scalar(const std::vector<uint8_t>& bytes) {
+  auto result = std::string(bytes.size() * 2, '\0');
+  sqlpp::detail::hex_encode_scalar(bytes.data(), bytes.size(), result.data());
+  return result;
+}
+}  // namespace
+
+int HexCodec(int, char*[]) {
+  using sqlpp::detail::hex_decode;
+
+  // Lengths around the vector widths to cover full blocks and tails.
+  for (size_t size = 0; size < 200; ++size) {
+    auto bytes = std::vector<uint8_t>(size);
+    for (size_t i = 0; i < size; ++i) {
+      bytes[i] = static_cast<uint8_t>(i * 37 + size);
+    }
+    const auto hex = encode(bytes);
+    require(__LINE__, hex == encode_scalar(bytes));
+
+    auto decoded = std::vector<uint8_t>(size);
+    require(__LINE__, hex_decode(hex.data(), hex.size(), decoded.data()) ==
+                          hex.size());
+    require(__LINE__, decoded == bytes);
+  }
+
+  {
+    const auto bytes = std::vector<uint8_t>{0x00, 0x0F, 0xA5, 0xFF};
+    require(__LINE__, encode(bytes) == "000FA5FF");
+  }
+
+  // Upper and lower case digits are accepted.
+  {
+    const auto hex =
+        std::string{"0123456789abcdefABCDEF0123456789abcdefABCDEF0123456789"
+                    "abcdefABCDEF"};
+    auto decoded = std::vector<uint8_t>(hex.size() / 2);
+    require(__LINE__, hex_decode(hex.data(), hex.size(), decoded.data()) ==
+                          hex.size());
+    require(__LINE__, decoded[5] == 0xab);
+    require(__LINE__, decoded[8] == 0xAB);
+    require(__LINE__, encode(decoded) == "0123456789ABCDEFABCDEF0123456789ABCDEF"
+                                         "ABCDEF0123456789ABCDEFABCDEF");
+  }
+
+  // Invalid characters are reported by position, in vectorized blocks and
+  // in the tail.
+  for (const auto position : {size_t{0}, size_t{1}, size_t{17}, size_t{40},
+                              size_t{63}, size_t{64}, size_t{129}}) {
+    for (const char invalid : {'g', 'G', ' ', '/', ':', '@', '`', '\xFF'}) {
+      auto hex = std::string(130, 'a');
+      hex[position] = invalid;
+      auto decoded = std::vector<uint8_t>(hex.size() / 2);
+      require(__LINE__, hex_decode(hex.data(), hex.size(), decoded.data()) ==
+                            position);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/core/all.h>
+
+int LazyRow(int, char*[]) {
+  sqlpp::mock_db::connection db = sqlpp::mock_db::make_test_connection();
+  const auto t = test::TabBar{};
+
+  // The id of the second row is NULL, which cannot be read into an int64_t.
+  db._mock_result_data.rows = {{"1", "cheese", "t", std::nullopt},
+                               {std::nullopt, "cake", "f", "17"}};
+
+  const auto query = select(all_of(t)).from(t);
+
+  // Regular rows read all fields.
+  try {
+    for (const auto& row : db(query)) {
+      std::ignore = row;
+    }
+    assert(false);
+  } catch (const std::bad_optional_access&) {
+  }
+
+  // Lazy rows only read the fields that are accessed.
+  {
+    auto text = std::string{};
+    for (const auto& row : db.select_lazy(query)) {
+      text += row.textN().value();
+      if (row.boolNn()) {
+        const int64_t id = row.id;
+        assert(id == 1);
+        assert(not row.intN().has_value());
+      } else {
+        assert(row.intN() == 17);
+      }
+    }
+    assert(text == "cheesecake");
+  }
+
+  // Prepared statements
+  {
+    auto prepared = db.prepare(query.where(t.id > sqlpp::parameter(t.id)));
+    prepared.parameters.id = 0;
+    auto result = db.select_lazy(prepared);
+    assert(result.front().textN() == "cheese");
+    result.pop_front();
+    assert(result.front().textN() == "cake");
+    result.pop_front();
+    assert(result.empty());
+  }
+
+  return 0;
+}
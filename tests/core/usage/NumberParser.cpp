@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cmath>
+#include <limits>
+
+#include <sqlpp23/tests/core/all.h>
+
+namespace {
+template <typename T>
+void require(int line, bool condition, const T& value) {
+  if (not condition) {
+    std::cerr << line << ": unexpected value " << value << std::endl;
+    throw std::runtime_error("Unexpected result");
+  }
+}
+}  // namespace
+
+int NumberParser(int, char*[]) {
+  using sqlpp::detail::parse_number;
+
+  {
+    int64_t value = 17;
+    require(__LINE__, parse_number(value, "-1234567890123"), value);
+    require(__LINE__, value == -1234567890123, value);
+    require(__LINE__, parse_number(value, "0"), value);
+    require(__LINE__, value == 0, value);
+    // Not a number
+    value = 17;
+    require(__LINE__, not parse_number(value, "abc"), value);
+    require(__LINE__, value == 0, value);
+    require(__LINE__, not parse_number(value, ""), value);
+    require(__LINE__, value == 0, value);
+    // Trailing characters are reported, the number is still parsed
+    require(__LINE__, not parse_number(value, "42 "), value);
+    require(__LINE__, value == 42, value);
+  }
+  {
+    uint64_t value = 0;
+    require(__LINE__, parse_number(value, "18446744073709551615"), value);
+    require(__LINE__, value == std::numeric_limits<uint64_t>::max(), value);
+  }
+  {
+    double value = 0;
+    require(__LINE__, parse_number(value, "1.5"), value);
+    require(__LINE__, value == 1.5, value);
+    require(__LINE__, parse_number(value, "-2.5e-3"), value);
+    require(__LINE__, value == -2.5e-3, value);
+    // PostgreSQL sends these for special values
+    require(__LINE__, parse_number(value, "Infinity"), value);
+    require(__LINE__, std::isinf(value) and value > 0, value);
+    require(__LINE__, parse_number(value, "-Infinity"), value);
+    require(__LINE__, std::isinf(value) and value < 0, value);
+    require(__LINE__, parse_number(value, "NaN"), value);
+    require(__LINE__, std::isnan(value), value);
+  }
+  {
+    // The input does not need to be null-terminated
+    const char buffer[] = {'1', '2', '3', '4'};
+    int64_t value = 0;
+    require(__LINE__, parse_number(value, std::string_view{buffer, 2}), value);
+    require(__LINE__, value == 12, value);
+  }
+
+  return 0;
+}
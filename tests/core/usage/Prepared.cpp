@@ -26,6 +26,27 @@
 
 #include <sqlpp23/tests/core/all.h>
 
+namespace {
+// Records the placeholder indexes that parameters are bound to.
+struct counting_target {
+  std::vector<size_t> bound;
+
+  void bind_null(size_t parameter_index) { bound.push_back(parameter_index); }
+};
+
+void bind_parameter(counting_target& target,
+                    size_t parameter_index,
+                    const int64_t&) {
+  target.bound.push_back(parameter_index);
+}
+
+void bind_parameter(counting_target& target,
+                    size_t parameter_index,
+                    const std::string_view&) {
+  target.bound.push_back(parameter_index);
+}
+}  // namespace
+
 int Prepared(int, char*[]) {
   sqlpp::mock_db::connection db = sqlpp::mock_db::make_test_connection();
   // test::TabFoo f;
@@ -146,6 +167,56 @@ int Prepared(int, char*[]) {
     std::cerr << x.id << std::endl;
   }
 
+  // Unchanged parameters are not bound again
+  {
+    using P = sqlpp::make_parameter_list_t<decltype(t.id == parameter(t.id) and
+                                                    t.textN ==
+                                                        parameter(t.textN))>;
+    auto p = P{};
+    auto target = counting_target{};
+    p._bind(target);
+    assert((target.bound == std::vector<size_t>{0, 1}));
+
+    target.bound.clear();
+    p._bind(target);
+    assert(target.bound.empty());
+
+    p.textN = "cheesecake";
+    p._bind(target);
+    assert((target.bound == std::vector<size_t>{1}));
+
+    target.bound.clear();
+    p.id = 7;
+    p.textN = "cheesecake";
+    p._bind(target);
+    assert((target.bound == std::vector<size_t>{0}));
+
+    // Values modified in place are bound again.
+    target.bound.clear();
+    p.textN.value()[0] = 'C';
+    p._bind(target);
+    assert((target.bound == std::vector<size_t>{1}));
+
+    // Copies bind all parameters.
+    target.bound.clear();
+    auto q = p;
+    q._bind(target);
+    assert((target.bound == std::vector<size_t>{0, 1}));
+  }
+
+  // Can we execute a prepared statement for a range of parameter values?
+  {
+    auto pu = db.prepare(update(t)
+                             .set(t.textN = parameter(t.textN))
+                             .where(t.id == parameter(t.id)));
+    const auto rows = std::vector<std::tuple<std::string, int64_t>>{
+        {"cheese", 1}, {"cake", 2}};
+    db.execute_many(pu, rows);
+    assert(pu.parameters.textN == "cake");
+    assert(pu.parameters.id == 2);
+    assert(not db.is_transaction_active());
+  }
+
   // Can we prepare a query without parameters?
   {
     auto ps = db.prepare(select(all_of(t)).from(t).where((t.textN.like("%"))));
@@ -154,5 +225,75 @@ int Prepared(int, char*[]) {
     }
   }
 
+  // Can we cache serialized statements by shape?
+  {
+    const auto make_select = [&t](bool by_id, bool by_text) {
+      return select(t.id, t.textN)
+          .from(t)
+          .where(t.boolNn == parameter(t.boolNn) and
+                 dynamic(by_id, t.id > parameter(t.id)) and
+                 dynamic(by_text, t.textN == parameter(t.textN)));
+    };
+
+    assert(sqlpp::dynamic_shape(make_select(false, false)) == 0);
+    assert(sqlpp::dynamic_shape(make_select(true, false)) == 1);
+    assert(sqlpp::dynamic_shape(make_select(false, true)) == 2);
+    assert(sqlpp::dynamic_shape(make_select(true, true)) == 3);
+    assert(sqlpp::dynamic_shape(select(t.id).from(t).where(true)) == 0);
+
+    // Dynamic parts of absent dynamic parts are not counted.
+    const auto make_nested = [&t](bool outer, bool inner) {
+      return select(t.id).from(t).where(
+          t.id != 0 and
+          dynamic(outer, t.boolNn and dynamic(inner, t.id > 17)) and
+          dynamic(true, t.id < 42));
+    };
+    assert(sqlpp::dynamic_shape(make_nested(false, true)) == 2);
+    assert(sqlpp::dynamic_shape(make_nested(true, false)) == 5);
+    assert(sqlpp::dynamic_shape(make_nested(true, true)) == 7);
+
+    // Only statements without literal values can be cached.
+    static_assert(std::is_same_v<sqlpp::serialization_cache_check_t<
+                                     decltype(make_select(true, true))>,
+                                 sqlpp::consistent_t>);
+    static_assert(std::is_same_v<
+                  sqlpp::serialization_cache_check_t<
+                      decltype(select(t.id).from(t).where(t.id > 17))>,
+                  sqlpp::assert_parameters_only_t>);
+    static_assert(std::is_same_v<
+                  sqlpp::serialization_cache_check_t<decltype(
+                      select(t.id).from(t).limit(10u))>,
+                  sqlpp::assert_parameters_only_t>);
+    static_assert(std::is_same_v<
+                  sqlpp::serialization_cache_check_t<decltype(
+                      select(t.id).from(t).order_by(
+                          t.id.asc()))>,
+                  sqlpp::assert_parameters_only_t>);
+
+    auto cache = sqlpp::serialization_cache{};
+    for (const auto by_id : {true, false, true, false}) {
+      auto ps = db.prepare(make_select(by_id, false), cache);
+      ps.parameters.boolNn = true;
+      ps.parameters.id = 17;
+      for (const auto& row : db(ps)) {
+        std::cerr << row.id << std::endl;
+      }
+    }
+    assert(cache.size() == 2);
+
+    auto context = sqlpp::mock_db::context_t{};
+    for (const auto by_id : {true, false}) {
+      for (const auto by_text : {true, false}) {
+        auto expected_context = sqlpp::mock_db::context_t{};
+        assert(cache.to_sql_string(context, make_select(by_id, by_text)) ==
+               to_sql_string(expected_context, make_select(by_id, by_text)));
+      }
+    }
+    assert(cache.size() == 4);
+
+    cache.clear();
+    assert(cache.size() == 0);
+  }
+
   return 0;
 }
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/core/database/result_cache.h>
+#include <sqlpp23/tests/core/all.h>
+
+namespace {
+// Invalidates the cache while a select is executed, like a concurrent writer
+// would between the cache lookup and the insert.
+struct racing_connection {
+  using _context_t = sqlpp::mock_db::context_t;
+
+  sqlpp::mock_db::connection& db;
+  sqlpp::result_cache& cache;
+
+  template <typename T>
+  auto operator()(const T& t) {
+    auto result = db(t);
+    cache.invalidate(test::TabBar{});
+    return result;
+  }
+};
+}  // namespace
+
+int ResultCache(int, char*[]) {
+  sqlpp::mock_db::connection db = sqlpp::mock_db::make_test_connection();
+  const auto bar = test::TabBar{};
+  const auto foo = test::TabFoo{};
+
+  auto cache = sqlpp::result_cache{};
+  auto cached = sqlpp::cached_connection{db, cache};
+
+  db._mock_result_data.rows = {{"1", "cheese", "t", std::nullopt},
+                               {"2", "cake", "f", "17"}};
+
+  const auto query = select(bar.id, bar.textN).from(bar).where(bar.id > 0);
+
+  // The first execution fills the cache.
+  const auto rows = cached(query);
+  assert(rows.size() == 2);
+  assert(rows.front().textN == "cheese");
+  assert(cache.size() == 1);
+  assert(cache.bytes() > 0);
+
+  // Later executions are answered from the cache, not the database.
+  db._mock_result_data.rows = {{"3", "cola", "t", std::nullopt}};
+  {
+    auto text = std::string{};
+    for (const auto& row : cached(query)) {
+      text += row.textN.value();
+    }
+    assert(text == "cheesecake");
+  }
+
+  // Statements with different values are cached separately.
+  assert(cached(select(bar.id, bar.textN).from(bar).where(bar.id > 1))
+             .front()
+             .textN == "cola");
+  assert(cache.size() == 2);
+
+  // Modifying another table does not invalidate the entries.
+  cached(update(foo).set(foo.doubleN = 1.0).where(foo.id > 0));
+  cached(delete_from(foo).where(foo.id == 17));
+  assert(cache.size() == 2);
+
+  // Modifying the table (also via an alias) does.
+  const auto b = bar.as(sqlpp::alias::b);
+  cached(insert_into(bar).set(bar.boolNn = true));
+  assert(cache.size() == 0);
+  assert(cache.bytes() == 0);
+  cached(query);
+  cached(delete_from(b).where(b.id == 1));
+  assert(cache.size() == 0);
+
+  // Sub queries are taken into account.
+  cached(select(foo.id).from(foo).where(foo.id.in(select(bar.id).from(bar))));
+  assert(cache.size() == 1);
+  cached(update(bar).set(bar.intN = 7).where(bar.id == 1));
+  assert(cache.size() == 0);
+
+  // Rows stay valid after they have been invalidated.
+  assert(rows[1].textN == "cake");
+
+  // Explicit invalidation.
+  cached(query);
+  cache.invalidate(foo);
+  assert(cache.size() == 1);
+  cache.invalidate(foo, bar);
+  assert(cache.size() == 0);
+
+  // Entries expire.
+  {
+    auto expiring = sqlpp::result_cache{{.ttl = std::chrono::seconds{0}}};
+    db._mock_result_data.rows = {{"1", "cheese", "t", std::nullopt}};
+    assert(expiring.select(db, query).front().textN == "cheese");
+    db._mock_result_data.rows = {{"2", "cake", "f", "17"}};
+    assert(expiring.select(db, query).front().textN == "cake");
+  }
+
+  // Results that exceed the budget are returned, but not cached.
+  {
+    auto tiny = sqlpp::result_cache{{.max_bytes = 1}};
+    assert(tiny.select(db, query).size() == 1);
+    assert(tiny.size() == 0);
+  }
+
+  // Rows of a query that raced with an invalidation are not cached.
+  {
+    auto racing_cache = sqlpp::result_cache{};
+    auto racing = racing_connection{db, racing_cache};
+    db._mock_result_data.rows = {{"1", "cheese", "t", std::nullopt}};
+    assert(racing_cache.select(racing, query).front().textN == "cheese");
+    assert(racing_cache.size() == 0);
+    db._mock_result_data.rows = {{"2", "cake", "f", "17"}};
+    assert(racing_cache.select(racing, query).front().textN == "cake");
+  }
+
+  // Within a transaction that modified data, selects bypass the cache and the
+  // modified tables are invalidated again on commit.
+  {
+    cache.clear();
+    db._mock_result_data.rows = {{"1", "cheese", "t", std::nullopt}};
+    cached(query);
+    assert(cache.size() == 1);
+
+    auto tx = start_transaction(cached);
+    cached(update(bar).set(bar.intN = 7).where(bar.id == 1));
+    assert(cache.size() == 0);
+    db._mock_result_data.rows = {{"2", "cake", "f", "17"}};
+    assert(cached(query).front().textN == "cake");
+    assert(cache.size() == 0);
+
+    // A concurrent reader caches data from before the commit.
+    cache.select(db, query);
+    assert(cache.size() == 1);
+    tx.commit();
+    assert(cache.size() == 0);
+    assert(not cached.is_transaction_active());
+
+    cached(query);
+    assert(cache.size() == 1);
+  }
+
+  return 0;
+}
@@ -25,6 +25,7 @@
  */
 
 #include <sqlpp23/tests/core/all.h>
+#include <sqlpp23/tests/core/assert_throw.h>
 
 int main(int, char*[]) {
   try {
@@ -53,6 +54,18 @@ int main(int, char*[]) {
       std::ignore = row.min_;
       std::ignore = row.sum_;
     }
+
+    // Frames of two bounds of the same kind must not start after they end.
+    std::ignore = sum(tab.intN).over().rows_between(sqlpp::preceding(5),
+                                                    sqlpp::preceding(1));
+    std::ignore = sum(tab.intN).over().rows_between(sqlpp::following(1),
+                                                    sqlpp::following(1));
+    assert_throw(sum(tab.intN).over().rows_between(sqlpp::preceding(1),
+                                                   sqlpp::preceding(5)),
+                 sqlpp::exception);
+    assert_throw(sum(tab.intN).over().range_between(sqlpp::following(5),
+                                                    sqlpp::following(1)),
+                 sqlpp::exception);
   } catch (const std::exception& e) {
     std::cerr << "Exception: " << e.what() << std::endl;
     return 1;
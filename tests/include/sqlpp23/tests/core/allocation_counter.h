@@ -0,0 +1,193 @@
+#pragma once
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global operators new and delete (all forms) to count
+// allocations, e.g. to make sure that re-executing a prepared statement does
+// not allocate.
+//
+// Include this header in exactly one translation unit of a test executable.
+namespace sqlpp::test {
+inline std::atomic<std::size_t> allocation_count{0};
+
+// Counts the allocations since its construction.
+class allocation_counter {
+ public:
+  allocation_counter() : _start{allocation_count.load()} {}
+
+  std::size_t count() const { return allocation_count.load() - _start; }
+
+ private:
+  std::size_t _start;
+};
+
+namespace detail {
+inline void* counted_allocate(std::size_t size,
+                              std::size_t alignment) noexcept {
+  ++allocation_count;
+  size = size == 0 ? 1 : size;
+  if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    return std::malloc(size);
+  }
+#if defined(_MSC_VER)
+  return _aligned_malloc(size, alignment);
+#else
+  // std::aligned_alloc requires the size to be a multiple of the alignment.
+  return std::aligned_alloc(alignment,
+                            (size + alignment - 1) / alignment * alignment);
+#endif
+}
+
+inline void* counted_allocate_or_throw(std::size_t size,
+                                       std::size_t alignment) {
+  if (void* ptr = counted_allocate(size, alignment)) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+inline void deallocate(void* ptr, std::size_t alignment) noexcept {
+#if defined(_MSC_VER)
+  if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    _aligned_free(ptr);
+    return;
+  }
+#endif
+  (void)alignment;
+  std::free(ptr);
+}
+}  // namespace detail
+}  // namespace sqlpp::test
+
+// Allocation
+
+void* operator new(std::size_t size) {
+  return sqlpp::test::detail::counted_allocate_or_throw(
+      size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t size) {
+  return sqlpp::test::detail::counted_allocate_or_throw(
+      size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return sqlpp::test::detail::counted_allocate_or_throw(
+      size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return sqlpp::test::detail::counted_allocate_or_throw(
+      size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  return sqlpp::test::detail::counted_allocate(
+      size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  return sqlpp::test::detail::counted_allocate(
+      size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size,
+                   std::align_val_t alignment,
+                   const std::nothrow_t&) noexcept {
+  return sqlpp::test::detail::counted_allocate(
+      size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size,
+                     std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+  return sqlpp::test::detail::counted_allocate(
+      size, static_cast<std::size_t>(alignment));
+}
+
+// Deallocation
+
+void operator delete(void* ptr) noexcept {
+  sqlpp::test::detail::deallocate(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* ptr) noexcept {
+  sqlpp::test::detail::deallocate(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  sqlpp::test::detail::deallocate(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+  sqlpp::test::detail::deallocate(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept {
+  sqlpp::test::detail::deallocate(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept {
+  sqlpp::test::detail::deallocate(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr,
+                     std::size_t,
+                     std::align_val_t alignment) noexcept {
+  sqlpp::test::detail::deallocate(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* ptr,
+                       std::size_t,
+                       std::align_val_t alignment) noexcept {
+  sqlpp::test::detail::deallocate(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  sqlpp::test::detail::deallocate(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  sqlpp::test::detail::deallocate(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* ptr,
+                     std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+  sqlpp::test::detail::deallocate(ptr, static_cast<std::size_t>(alignment));
+}
+
+void operator delete[](void* ptr,
+                       std::align_val_t alignment,
+                       const std::nothrow_t&) noexcept {
+  sqlpp::test::detail::deallocate(ptr, static_cast<std::size_t>(alignment));
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+#include <sqlpp23/tests/core/allocation_counter.h>
+
+namespace sqlpp::test {
+// Re-executing a prepared select must not allocate once the buffers for
+// parameters and results are warmed up. `tab` is an empty test::TabFoo in
+// `db`, which should not log (logging formats messages, which allocates).
+template <typename Connection, typename TabFoo>
+void test_prepared_select_allocations(Connection& db, const TabFoo& tab) {
+  for (int64_t i = 0; i < 10; ++i) {
+    db(insert_into(tab).set(tab.textNnD = "cheesecake", tab.intN = i,
+                            tab.doubleN = 0.5 * static_cast<double>(i)));
+  }
+
+  auto prepared = db.prepare(select(tab.id, tab.textNnD, tab.intN, tab.doubleN)
+                                 .from(tab)
+                                 .where(tab.intN >= parameter(tab.intN) and
+                                        tab.textNnD != parameter(tab.textNnD)));
+  const auto run = [&](int64_t min) {
+    prepared.parameters.intN = min;
+    prepared.parameters.textNnD = "cake";
+    std::size_t count = 0;
+    for (const auto& row : db(prepared)) {
+      assert(row.textNnD == "cheesecake");
+      assert(row.intN.value() >= min);
+      ++count;
+    }
+    return count;
+  };
+
+  // Warm up the buffers.
+  assert(run(0) == 10);
+
+  const auto counter = allocation_counter{};
+  for (const int64_t min : {0, 3, 5, 7, 5}) {
+    assert(run(min) == static_cast<std::size_t>(10 - min));
+  }
+  assert(counter.count() == 0);
+}
+}  // namespace sqlpp::test
@@ -47,6 +47,7 @@ import sqlpp23.core;
 import sqlpp23.sqlite3;
 import sqlpp23.test.sqlite3.tables;
 #else
+#include <sqlpp23/core/arrow/record_batch.h>
 #include <sqlpp23/core/database/connection_pool.h>
 #include <sqlpp23/sqlite3/sqlite3.h>
 #include <sqlpp23/sqlpp23.h>
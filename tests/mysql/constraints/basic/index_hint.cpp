@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/mysql/all.h>
+
+namespace {
+SQLPP_CREATE_NAME_TAG(idx_foo);
+}
+
+int main() {
+  auto db = sqlpp::mysql::make_test_connection();
+  auto ctx = sqlpp::mysql::context_t{&db};
+  using CTX = decltype(ctx);
+
+  const auto foo = test::TabFoo{};
+  const auto bar = test::TabBar{};
+
+  // OK
+  {
+    auto a = sqlpp::use_index(foo, idx_foo);
+    auto b = sqlpp::force_index(foo.as(sqlpp::alias::a), idx_foo);
+    auto c = select(sqlpp::optimizer_hints(
+                        sqlpp::join_order(bar, foo),
+                        sqlpp::max_execution_time(
+                            std::chrono::milliseconds{1000})),
+                    foo.id)
+                 .from(sqlpp::ignore_index(foo, idx_foo)
+                           .join(bar)
+                           .on(foo.id == bar.id));
+
+    static_assert(std::is_same<decltype(check_compatibility<CTX>(a)),
+                               sqlpp::consistent_t>::value);
+    static_assert(std::is_same<decltype(check_compatibility<CTX>(b)),
+                               sqlpp::consistent_t>::value);
+    static_assert(std::is_same<decltype(check_compatibility<CTX>(c)),
+                               sqlpp::consistent_t>::value);
+  }
+
+  // No support for SQLite index hints
+  {
+    auto a = sqlpp::indexed_by(foo, idx_foo);
+    auto b = select(foo.id).from(sqlpp::not_indexed(foo));
+
+    static_assert(std::is_same<decltype(check_compatibility<CTX>(a)),
+                               sqlpp::mysql::assert_no_indexed_by>::value);
+    static_assert(std::is_same<decltype(check_compatibility<CTX>(b)),
+                               sqlpp::mysql::assert_no_indexed_by>::value);
+  }
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/mysql/all.h>
+
+int main(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  const auto new_foo = foo.as(sqlpp::alias::n);
+
+  // Single row
+  SQLPP_COMPARE(sqlpp::mysql::insert_into(foo)
+                    .set(foo.id = 7, foo.intN = 5)
+                    .on_duplicate_key_update(foo.intN = 5),
+                "INSERT INTO tab_foo (id, int_n) VALUES(7, 5) ON DUPLICATE "
+                "KEY UPDATE int_n = 5");
+
+  // VALUES(column)
+  SQLPP_COMPARE(sqlpp::mysql::insert_into(foo)
+                    .set(foo.id = 7, foo.intN = 5)
+                    .on_duplicate_key_update(
+                        foo.intN = foo.intN + sqlpp::mysql::values(foo.intN)),
+                "INSERT INTO tab_foo (id, int_n) VALUES(7, 5) ON DUPLICATE "
+                "KEY UPDATE int_n = (tab_foo.int_n + VALUES(int_n))");
+
+  // Multiple rows with row alias and dynamic assignments
+  {
+    auto i = sqlpp::mysql::insert_into(foo)
+                 .columns(foo.id, foo.textNnD)
+                 .on_duplicate_key_update(new_foo,
+                                          foo.textNnD = new_foo.textNnD,
+                                          dynamic(false, foo.intN = 1),
+                                          dynamic(true, foo.boolN = true));
+    i.add_values(foo.id = 1, foo.textNnD = "one");
+    i.add_values(foo.id = 2, foo.textNnD = "two");
+    SQLPP_COMPARE(i,
+                  "INSERT INTO tab_foo (id, text_nn_d) VALUES (1, 'one'), "
+                  "(2, 'two') AS n ON DUPLICATE KEY UPDATE text_nn_d = "
+                  "n.text_nn_d, bool_n = 1");
+  }
+
+  return 0;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <sqlpp23/tests/mysql/all.h>
+
+namespace sql = sqlpp::mysql;
+
+int InsertOnDuplicateKeyUpdate(int, char*[]) {
+  sql::global_library_init();
+  try {
+    const auto tab = test::TabFoo{};
+    auto db = sql::make_test_connection();
+    test::createTabFoo(db);
+
+    // Insert new rows
+    {
+      auto i = sql::insert_into(tab)
+                   .columns(tab.id, tab.textNnD, tab.intN)
+                   .on_duplicate_key_update(
+                       tab.intN = tab.intN + sql::values(tab.intN));
+      i.add_values(tab.id = 1, tab.textNnD = "one", tab.intN = 1);
+      i.add_values(tab.id = 2, tab.textNnD = "two", tab.intN = 2);
+      db(i);
+    }
+
+    // Update existing rows, insert a new one
+    {
+      auto i = sql::insert_into(tab)
+                   .columns(tab.id, tab.textNnD, tab.intN)
+                   .on_duplicate_key_update(
+                       tab.intN = tab.intN + sql::values(tab.intN),
+                       tab.textNnD = sql::values(tab.textNnD));
+      i.add_values(tab.id = 2, tab.textNnD = "zwei", tab.intN = 20);
+      i.add_values(tab.id = 3, tab.textNnD = "three", tab.intN = 3);
+      db(i);
+    }
+
+    // Prepared
+    {
+      auto pi = db.prepare(
+          sql::insert_into(tab)
+              .set(tab.id = parameter(tab.id), tab.intN = 7)
+              .on_duplicate_key_update(tab.intN = tab.intN * 10));
+      pi.parameters.id = 3;
+      db(pi);
+    }
+
+    auto expected = std::vector<std::tuple<int64_t, std::string, int64_t>>{
+        {1, "one", 1}, {2, "zwei", 22}, {3, "three", 30}};
+    auto actual = std::vector<std::tuple<int64_t, std::string, int64_t>>{};
+    for (const auto& row : db(sqlpp::select(tab.id, tab.textNnD, tab.intN)
+                                  .from(tab)
+                                  .where(true)
+                                  .order_by(tab.id.asc()))) {
+      actual.emplace_back(row.id, row.textNnD, row.intN.value());
+    }
+    if (actual != expected) {
+      throw std::runtime_error("unexpected result of upserts");
+    }
+  } catch (const std::exception& e) {
+    std::cerr << "Exception: " << e.what() << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -24,6 +24,10 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+#include <stop_token>
+#include <thread>
+
 #include <sqlpp23/tests/mysql/all.h>
 
 namespace sql = sqlpp::mysql;
@@ -59,6 +63,41 @@ int main() {
         throw std::runtime_error("unexpected meta information in exception");
       }
     }
+
+    // Selects running into the statement timeout are aborted
+    db("SET SESSION cte_max_recursion_depth = 4294967295");
+    const auto runaway =
+        "WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c) "
+        "SELECT count(*) FROM c";
+    db.set_statement_timeout(std::chrono::milliseconds{100});
+    assert_throw(db(runaway), sql::timeout_exception);
+    db.set_statement_timeout(std::chrono::milliseconds{0});
+
+    // Statements can be canceled from another thread
+    {
+      auto canceler = std::jthread{[handle = db.get_cancel_handle()](
+                                       std::stop_token stop) {
+        while (not stop.stop_requested()) {
+          handle.cancel();
+          std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+      }};
+      assert_throw(db(runaway), sql::timeout_exception);
+    }
+
+    // Cancel handles do nothing once their connection is moved or closed
+    {
+      auto handle = db.get_cancel_handle();
+      handle.cancel();
+      auto other = std::move(db);
+      handle.cancel();
+      db = std::move(other);
+      {
+        auto closed = sql::make_test_connection();
+        handle = closed.get_cancel_handle();
+      }
+      handle.cancel();
+    }
   } catch (const std::exception& e) {
     std::println("unexpected exception: {}", e.what());
     return 1;
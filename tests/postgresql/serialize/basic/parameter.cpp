@@ -115,5 +115,14 @@ int main() {
           foo.intN = parameter(foo.intN), foo.textNnD = parameter(foo.textNnD)),
       " ON CONFLICT (id) DO UPDATE SET int_n = $1, text_nn_d = $2");
 
+  // Array parameters are bound as a single PostgreSQL array.
+  SQLPP_COMPARE(foo.id.in(sqlpp::array_parameter<16>(foo.id)),
+                "tab_foo.id = ANY($1)");
+  SQLPP_COMPARE(foo.id.not_in(sqlpp::array_parameter<16>(foo.id)),
+                "tab_foo.id <> ALL($1)");
+  SQLPP_COMPARE(parameter(foo.doubleN) > 7 and
+                    foo.id.in(sqlpp::array_parameter<16>(foo.id)),
+                "($1 > 7) AND (tab_foo.id = ANY($2))");
+
   return 0;
 }
@@ -24,6 +24,7 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <sqlpp23/core/query/keyset.h>
 #include <sqlpp23/tests/postgresql/all.h>
 
 int main() {
@@ -39,5 +40,14 @@ int main() {
            .limit(parameter(sqlpp::integral{}, sqlpp::alias::d))),
       "SELECT $1 AS a FROM tab_foo WHERE $2 LIMIT $3 OFFSET $4");
 
+  // Keyset pagination: In PostgreSQL, NULL sorts last in ascending order.
+  SQLPP_COMPARE(sqlpp::keyset(foo.intN.asc(), foo.id.asc())
+                    .after(std::optional<int64_t>{}, 17),
+                "(tab_foo.int_n IS NULL AND tab_foo.id > 17)");
+  SQLPP_COMPARE(
+      sqlpp::keyset(foo.textNnD.asc(), foo.id.desc()).after_parameters(),
+      "(tab_foo.text_nn_d >= $1 AND (tab_foo.text_nn_d > $2 OR "
+      "tab_foo.id < $3))");
+
   return 0;
 }
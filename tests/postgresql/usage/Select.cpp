@@ -26,6 +26,7 @@
 
 #include <cassert>
 #include <chrono>
+#include <memory_resource>
 #include "sqlpp23/core/basic/parameter.h"
 #include "sqlpp23/core/type_traits/data_type.h"
 
@@ -82,10 +83,197 @@ void testParameter(sql::connection& db) {
   }
 }
 
+void testUnnamed(sql::connection& db) {
+  // Unnamed statements are executed via PQexecParams.
+  auto ps = db.prepare_unnamed(
+      select(tab.id)
+          .from(tab)
+          .where(tab.id.in(sqlpp::array_parameter<8>(tab.id)) and
+                 tab.textNnD == parameter(tab.textNnD)));
+  ps.parameters.id = {1, 2, 3};
+  ps.parameters.textNnD = "cheesecake";
+  int count = 0;
+  for (const auto& row : db(ps)) {
+    assert(row.id == 2 or row.id == 3);
+    ++count;
+  }
+  assert(count == 2);
+
+  // Unnamed statements can be executed more than once.
+  ps.parameters.id = {3, 4};
+  count = 0;
+  for (const auto& row : db(ps)) {
+    assert(row.id == 3);
+    ++count;
+  }
+  assert(count == 1);
+}
+
 namespace {
 SQLPP_CREATE_NAME_TAG(something);
 }
 
+void testDeferredDeallocation() {
+  auto config = sql::make_test_config();
+  config->deallocate_batch_size = 3;
+  sql::connection db;
+  db.connect_using(config);
+
+  const auto count_prepared = [&db]() {
+    return db(select(sqlpp::verbatim<sqlpp::integral>(
+                         "(SELECT COUNT(*) FROM pg_prepared_statements)")
+                         .as(something)))
+        .begin()
+        ->something;
+  };
+  const auto prepare_and_destroy = [&db]() {
+    auto ps = db.prepare(select(sqlpp::value(1).as(something)));
+    db(ps);
+  };
+
+  // Destroyed statements are deallocated in batches.
+  prepare_and_destroy();
+  prepare_and_destroy();
+  assert(count_prepared() == 2);
+  prepare_and_destroy();
+  assert(count_prepared() == 0);
+
+  // Deallocation is postponed while a transaction is open.
+  {
+    auto tx = start_transaction(db);
+    prepare_and_destroy();
+    prepare_and_destroy();
+    prepare_and_destroy();
+    assert(count_prepared() == 3);
+    tx.commit();
+  }
+  assert(count_prepared() == 0);
+
+  // Names that the server does not know anymore are dropped without error.
+  prepare_and_destroy();
+  prepare_and_destroy();
+  db("DISCARD ALL");
+  prepare_and_destroy();
+  assert(count_prepared() == 0);
+  prepare_and_destroy();
+  prepare_and_destroy();
+  prepare_and_destroy();
+  assert(count_prepared() == 0);
+}
+
+void testAutoPrepare() {
+  auto config = sql::make_test_config();
+  config->prepare_threshold = 2;
+  sql::connection db;
+  db.connect_using(config);
+
+  // The second execution of the same SQL text prepares it on the server.
+  for (int i = 0; i < 3; ++i) {
+    const auto result = db(select(sqlpp::value(17).as(something)));
+    assert(result.begin()->something == 17);
+  }
+  const auto count = db(select(sqlpp::verbatim<sqlpp::integral>(
+                                   "(SELECT COUNT(*) FROM pg_prepared_statements)")
+                                   .as(something)))
+                         .begin()
+                         ->something;
+  assert(count == 1);
+
+  // The least recently used statement is evicted from the cache.
+  config = sql::make_test_config();
+  config->prepare_threshold = 1;
+  config->auto_prepare_cache_size = 2;
+  config->deallocate_batch_size = 1;
+  db.connect_using(config);
+  const auto run = [&db](int64_t value) {
+    const auto result = db(select(sqlpp::value(value).as(something)));
+    assert(result.begin()->something == value);
+  };
+  // Explicitly prepared, i.e. not subject to auto-preparation. The search
+  // term is computed so that this statement does not match itself.
+  const auto is_prepared = [&db](int64_t value) {
+    auto ps = db.prepare(select(
+        sqlpp::verbatim<sqlpp::integral>(
+            "(SELECT COUNT(*) FROM pg_prepared_statements WHERE statement "
+            "LIKE '%' || (" +
+            std::to_string(value / 10) + " * 10)::text || '%')")
+            .as(something)));
+    return db(ps).begin()->something == 1;
+  };
+  run(2000);
+  run(3000);
+  run(2000);
+  run(4000);
+  assert(is_prepared(2000));
+  assert(not is_prepared(3000));
+  assert(is_prepared(4000));
+}
+
+void testExecuteMany(sql::connection& db) {
+  // The statements are sent in pipeline mode.
+  auto pu = db.prepare(update(tab)
+                           .set(tab.intN = parameter(tab.intN))
+                           .where(tab.id == parameter(tab.id)));
+  const auto updates = std::vector<std::tuple<int64_t, int64_t>>{
+      {10, 1}, {20, 2}, {30, 3}, {40, 4}};
+  assert(db.execute_many(pu, updates) == 3);
+  for (const auto& row : db(select(tab.id, tab.intN).from(tab))) {
+    assert(row.intN == row.id * 10);
+  }
+
+  // The first error is reported and all changes are rolled back.
+  auto pi = db.prepare(insert_into(tab).set(tab.id = parameter(tab.id)));
+  const auto inserts = std::vector<std::tuple<int64_t>>{{100}, {1}, {101}};
+  try {
+    db.execute_many(pi, inserts);
+    assert(false);
+  } catch (const sql::result_exception&) {
+  }
+  assert(not db.is_transaction_active());
+  assert(db(select(tab.id).from(tab).where(tab.id >= 100)).empty());
+}
+
+namespace {
+// Counts the bytes allocated via the upstream resource.
+class counting_resource : public std::pmr::memory_resource {
+ public:
+  size_t allocated = 0;
+
+ private:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    allocated += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource& other) const
+      noexcept override {
+    return this == &other;
+  }
+};
+}  // namespace
+
+void testMemoryResource(sql::connection& db) {
+  auto arena = counting_resource{};
+  db.set_memory_resource(&arena);
+  {
+    auto ps = db.prepare(select(tab.id, tab.textNnD, tab.blobN)
+                             .from(tab)
+                             .where(tab.textNnD != parameter(tab.textNnD)));
+    ps.parameters.textNnD = "a rather long text to avoid the small string "
+                            "optimization";
+    for (const auto& row : db(ps)) {
+      std::ignore = row.blobN;
+    }
+  }
+  assert(arena.allocated > 0);
+  db.set_memory_resource(nullptr);
+  assert(db.get_memory_resource() == std::pmr::get_default_resource());
+}
+
 int Select(int, char*[]) {
   sql::connection db = sql::make_test_connection();
 
@@ -100,6 +288,11 @@ int Select(int, char*[]) {
   testSelectAll(db, 3);
 
   testParameter(db);
+  testUnnamed(db);
+  testDeferredDeallocation();
+  testAutoPrepare();
+  testExecuteMany(db);
+  testMemoryResource(db);
 
   // Test size functionality
   const auto test_size = db(select(all_of(tab)).from(tab));
@@ -24,6 +24,10 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+#include <stop_token>
+#include <thread>
+
 #include <sqlpp23/tests/postgresql/all.h>
 
 namespace sql = sqlpp::postgresql;
@@ -61,6 +65,33 @@ int main() {
         throw std::runtime_error("unexpected meta information in exception");
       }
     }
+
+    // Statements running into the statement timeout are canceled
+    db.set_statement_timeout(std::chrono::milliseconds{100});
+    assert_throw(db("SELECT pg_sleep(10)"), sql::timeout_exception);
+    db.set_statement_timeout(std::chrono::milliseconds{0});
+
+    // The statement timeout cannot be set within a transaction
+    {
+      auto tx = start_transaction(db);
+      assert_throw(db.set_statement_timeout(std::chrono::milliseconds{100}),
+                   sqlpp::exception);
+    }
+
+    // Statements can be canceled from another thread
+    {
+      auto canceler = std::jthread{[handle = db.get_cancel_handle()](
+                                       std::stop_token stop) {
+        while (not stop.stop_requested()) {
+          handle.cancel();
+          std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+      }};
+      assert_throw(db("SELECT pg_sleep(10)"), sql::timeout_exception);
+    }
+
+    // The connection is still usable
+    db("SELECT 1");
   } catch (const std::exception& e) {
     std::println("unexpected exception: {}", e.what());
     return 1;
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstring>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+namespace {
+template <typename T>
+T value_at(const ArrowArray& array, int64_t index) {
+  T value;
+  std::memcpy(&value, static_cast<const uint8_t*>(array.buffers[1]) +
+                          index * static_cast<int64_t>(sizeof(T)),
+              sizeof(T));
+  return value;
+}
+
+bool is_valid(const ArrowArray& array, int64_t index) {
+  if (array.buffers[0] == nullptr) {
+    return true;
+  }
+  const auto* bits = static_cast<const uint8_t*>(array.buffers[0]);
+  return (bits[index / 8] >> (index % 8)) & 1;
+}
+
+std::string_view string_at(const ArrowArray& array, int64_t index) {
+  const auto* offsets = static_cast<const int64_t*>(array.buffers[1]);
+  const auto* data = static_cast<const char*>(array.buffers[2]);
+  return std::string_view{data + offsets[index],
+                          static_cast<size_t>(offsets[index + 1] -
+                                              offsets[index])};
+}
+}  // namespace
+
+int Arrow(int, char*[]) {
+  const auto tab = test::TabFoo{};
+
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+
+  db(insert_into(tab).set(tab.textNnD = "one", tab.intN = 1, tab.boolN = true,
+                          tab.doubleN = 1.5));
+  db(insert_into(tab).set(tab.textNnD = "two", tab.intN = std::nullopt,
+                          tab.boolN = false));
+  db(insert_into(tab).set(tab.textNnD = "three", tab.intN = 3,
+                          tab.blobN = std::vector<uint8_t>{0x01, 0x02}));
+
+  const auto query = select(tab.id, tab.textNnD, tab.intN, tab.doubleN,
+                            tab.boolN, tab.blobN)
+                         .from(tab)
+                         .order_by(tab.id.asc());
+
+  // Schema
+  {
+    auto result = db(query);
+    ArrowSchema schema;
+    sqlpp::arrow::export_schema(result, &schema);
+    assert(std::string_view{schema.format} == "+s");
+    assert(schema.n_children == 6);
+    assert(std::string_view{schema.children[0]->format} == "l");
+    assert(std::string_view{schema.children[0]->name} == "id");
+    assert(schema.children[0]->flags == 0);
+    assert(std::string_view{schema.children[1]->format} == "U");
+    assert(std::string_view{schema.children[1]->name} == "text_nn_d");
+    assert(std::string_view{schema.children[2]->format} == "l");
+    assert(schema.children[2]->flags == sqlpp::arrow::nullable_flag);
+    assert(std::string_view{schema.children[3]->format} == "g");
+    assert(std::string_view{schema.children[4]->format} == "b");
+    assert(std::string_view{schema.children[5]->format} == "Z");
+    schema.release(&schema);
+    assert(schema.release == nullptr);
+  }
+
+  // Record batches of bounded size
+  {
+    auto result = db(query);
+    ArrowArray batch;
+    assert(sqlpp::arrow::export_record_batch(result, &batch, 2) == 2);
+    assert(batch.length == 2);
+    assert(batch.n_children == 6);
+
+    const auto& id = *batch.children[0];
+    assert(value_at<int64_t>(id, 0) == 1);
+    assert(value_at<int64_t>(id, 1) == 2);
+
+    const auto& text = *batch.children[1];
+    assert(string_at(text, 0) == "one");
+    assert(string_at(text, 1) == "two");
+
+    const auto& int_n = *batch.children[2];
+    assert(int_n.null_count == 1);
+    assert(is_valid(int_n, 0));
+    assert(not is_valid(int_n, 1));
+    assert(value_at<int64_t>(int_n, 0) == 1);
+
+    const auto& double_n = *batch.children[3];
+    assert(value_at<double>(double_n, 0) == 1.5);
+
+    const auto& bool_n = *batch.children[4];
+    assert(bool_n.null_count == 0);
+    const auto* bits = static_cast<const uint8_t*>(bool_n.buffers[1]);
+    assert((bits[0] & 0x03) == 0x01);
+
+    const auto& blob_n = *batch.children[5];
+    assert(blob_n.null_count == 2);
+    batch.release(&batch);
+    assert(batch.release == nullptr);
+
+    assert(sqlpp::arrow::export_record_batch(result, &batch, 2) == 1);
+    assert(string_at(*batch.children[1], 0) == "three");
+    assert(string_at(*batch.children[5], 0) == "\x01\x02");
+    assert(not is_valid(*batch.children[4], 0));
+    batch.release(&batch);
+
+    assert(sqlpp::arrow::export_record_batch(result, &batch, 2) == 0);
+    assert(batch.length == 0);
+    batch.release(&batch);
+  }
+
+  // Stream
+  {
+    ArrowArrayStream stream;
+    sqlpp::arrow::export_stream(db(query), &stream, 2);
+
+    ArrowSchema schema;
+    assert(stream.get_schema(&stream, &schema) == 0);
+    assert(schema.n_children == 6);
+    schema.release(&schema);
+
+    int64_t rows = 0;
+    int batches = 0;
+    while (true) {
+      ArrowArray batch;
+      assert(stream.get_next(&stream, &batch) == 0);
+      if (batch.release == nullptr) {
+        break;
+      }
+      rows += batch.length;
+      ++batches;
+      batch.release(&batch);
+    }
+    assert(rows == 3);
+    assert(batches == 2);
+    assert(stream.get_last_error(&stream) == nullptr);
+    stream.release(&stream);
+    assert(stream.release == nullptr);
+  }
+
+  return 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int InsertSelect(int, char*[]) {
+  const auto foo = test::TabFoo{};
+  const auto bar = test::TabBar{};
+
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+  test::createTabBar(db);
+
+  {
+    auto i = insert_into(bar).columns(bar.boolNn, bar.intN);
+    for (int64_t n = 1; n <= 10; ++n) {
+      i.add_values(bar.boolNn = n % 2 == 0, bar.intN = n);
+    }
+    db(i);
+  }
+
+  // Copy some of the rows server-side.
+  db(insert_into(foo)
+         .columns(foo.intN, foo.boolN)
+         .select(select((bar.intN * 10).as(sqlpp::alias::a), bar.boolNn)
+                     .from(bar)
+                     .where(bar.intN > 5)));
+
+  int64_t rows = 0;
+  for (const auto& row : db(select(foo.textNnD, foo.intN, foo.boolN)
+                                .from(foo)
+                                .order_by(foo.intN.asc()))) {
+    ++rows;
+    const auto n = 5 + rows;
+    assert(row.textNnD == "");
+    assert(row.intN == n * 10);
+    assert(row.boolN == (n % 2 == 0));
+  }
+  assert(rows == 5);
+
+  // With parameters
+  auto pi = db.prepare(insert_into(foo)
+                           .columns(foo.textNnD, foo.intN)
+                           .select(select(sqlpp::value("copy").as(
+                                              sqlpp::alias::a),
+                                          bar.intN)
+                                       .from(bar)
+                                       .where(bar.intN <
+                                              parameter(bar.intN))));
+  pi.parameters.intN = 3;
+  db(pi);
+  for (const auto& row :
+       db(select(count(foo.id).as(sqlpp::alias::a))
+              .from(foo)
+              .where(foo.textNnD == "copy"))) {
+    assert(row.a == 2);
+  }
+
+  return 0;
+}
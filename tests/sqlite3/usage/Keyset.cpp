@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include <sqlpp23/core/query/keyset.h>
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int Keyset(int, char*[]) {
+  const auto tab = test::TabFoo{};
+
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+
+  {
+    auto tx = start_transaction(db);
+    for (int64_t i = 1; i <= 100; ++i) {
+      // Ten rows per text value, so that the second key breaks ties.
+      db(insert_into(tab).set(tab.textNnD = std::to_string(i % 10),
+                              tab.intN = i % 3 == 0 ? std::nullopt
+                                                    : std::optional{i}));
+    }
+    tx.commit();
+  }
+
+  const auto keys = sqlpp::keyset(tab.textNnD.desc(), tab.id.asc());
+
+  // All rows, in order, across several pages.
+  for (const size_t page_size : {1u, 7u, 10u, 100u, 1000u}) {
+    auto pages = sqlpp::keyset_pages(db, keys, page_size, [&](auto condition) {
+      return select(tab.id, tab.textNnD).from(tab).where(condition);
+    });
+    auto expected = db(keys.order_by(select(tab.id, tab.textNnD).from(tab)));
+    size_t count = 0;
+    for (const auto& row : pages) {
+      assert(not expected.empty());
+      assert(row.id == expected.front().id);
+      assert(row.textNnD == expected.front().textNnD);
+      expected.pop_front();
+      ++count;
+    }
+    assert(expected.empty());
+    assert(count == 100);
+    assert(pages.page_count() == (100 + page_size - 1) / page_size);
+  }
+
+  // Additional conditions
+  {
+    auto pages = sqlpp::keyset_pages(db, keys, 3, [&](auto condition) {
+      return select(tab.id).from(tab).where(tab.id > 90 and condition);
+    });
+    std::vector<int64_t> ids;
+    for (const auto& row : pages) {
+      ids.push_back(row.id);
+    }
+    assert((ids == std::vector<int64_t>{99, 98, 97, 96, 95, 94, 93, 92, 91,
+                                        100}));
+  }
+
+  // Seeking with nullable keys, NULL is smaller than other values in SQLite.
+  {
+    const auto nullable = sqlpp::keyset(tab.intN.asc(), tab.id.asc());
+    const auto after = [&](std::optional<int64_t> int_n, int64_t id) {
+      return db(nullable.order_by(
+                    select(tab.id).from(tab).where(nullable.after(int_n, id)))
+                    .limit(1u))
+          .front()
+          .id;
+    };
+    assert(after(std::nullopt, 3) == 6);
+    assert(after(std::nullopt, 99) == 1);
+    assert(after(1, 1) == 2);
+    assert(after(2, 2) == 4);
+  }
+
+  return 0;
+}
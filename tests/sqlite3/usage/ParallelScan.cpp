@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sqlpp23/core/database/parallel_scan.h>
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int ParallelScan(int, char*[]) {
+  if (not sqlite3_threadsafe()) {
+    return 0;
+  }
+
+  const auto tab = test::TabFoo{};
+
+  auto config = std::make_shared<sql::connection_config>();
+  config->path_to_database = "file:parallel_scan?mode=memory&cache=shared";
+  config->flags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_URI;
+  config->debug = sql::get_debug_logger();
+  auto pool = sql::connection_pool{config, 4};
+
+  // The shared in-memory database lives as long as one connection is open.
+  auto db = pool.get();
+  test::createTabFoo(db);
+
+  const auto by_range = [&tab](const auto& range) {
+    return select(tab.id, tab.textNnD)
+        .from(tab)
+        .where(range)
+        .order_by(tab.id.asc());
+  };
+
+  // Empty table
+  {
+    auto rows = std::vector<int64_t>{};
+    auto mutex = std::mutex{};
+    sqlpp::parallel_scan(pool, tab.id, 4, by_range,
+                         [&](size_t, const auto& row) {
+                           const auto lock = std::lock_guard{mutex};
+                           rows.push_back(row.id);
+                         });
+    assert(rows.empty());
+  }
+
+  {
+    auto tx = start_transaction(db);
+    for (int64_t i = 1; i <= 1000; ++i) {
+      db(insert_into(tab).set(tab.textNnD = std::to_string(i)));
+    }
+    tx.commit();
+  }
+
+  // Equal-width ranges between min and max: each key is read exactly once,
+  // and concatenating the partitions yields the keys in order.
+  {
+    auto partitions = std::vector<std::vector<int64_t>>(4);
+    sqlpp::parallel_scan(pool, tab.id, partitions.size(), by_range,
+                         [&](size_t partition, const auto& row) {
+                           assert(row.textNnD == std::to_string(row.id));
+                           partitions[partition].push_back(row.id);
+                         });
+    auto ids = std::vector<int64_t>{};
+    for (const auto& partition : partitions) {
+      assert(not partition.empty());
+      ids.insert(ids.end(), partition.begin(), partition.end());
+    }
+    assert(ids.size() == 1000);
+    for (size_t i = 0; i < ids.size(); ++i) {
+      assert(ids[i] == static_cast<int64_t>(i + 1));
+    }
+  }
+
+  // User-provided split points, unsorted and with duplicates.
+  {
+    auto partitions = std::vector<std::vector<int64_t>>(3);
+    sqlpp::parallel_scan(pool, tab.id, std::vector<int64_t>{700, 100, 700},
+                         by_range, [&](size_t partition, const auto& row) {
+                           partitions[partition].push_back(row.id);
+                         });
+    assert(partitions[0].size() == 99);
+    assert(partitions[1].size() == 600);
+    assert(partitions[2].size() == 301);
+    assert(partitions[1].front() == 100);
+    assert(partitions[2].front() == 700);
+  }
+
+  // Errors of one partition are rethrown after all partitions stopped.
+  {
+    try {
+      sqlpp::parallel_scan(pool, tab.id, 4, by_range,
+                           [](size_t partition, const auto&) {
+                             if (partition == 2) {
+                               throw std::runtime_error{"partition 2"};
+                             }
+                           });
+      assert(false);
+    } catch (const std::runtime_error& e) {
+      assert(std::string{e.what()} == "partition 2");
+    }
+  }
+
+  // The connections are back in the pool.
+  assert(pool.available() >= 1);
+  for (const auto& row :
+       db(select(count(tab.id).as(sqlpp::alias::a)).from(tab))) {
+    assert(row.a == 1000);
+  }
+
+  return 0;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <string>
+
+#include <sqlpp23/core/query/read_ahead.h>
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int ReadAhead(int, char*[]) {
+  const auto tab = test::TabFoo{};
+
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+
+  {
+    auto tx = start_transaction(db);
+    for (int64_t i = 1; i <= 100; ++i) {
+      db(insert_into(tab).set(tab.textNnD = std::to_string(i), tab.intN = i));
+    }
+    tx.commit();
+  }
+
+  const auto query =
+      select(tab.id, tab.textNnD, tab.intN).from(tab).order_by(tab.id.asc());
+
+  // All rows, in order, across several batches.
+  {
+    int64_t expected = 0;
+    for (const auto& row : sqlpp::read_ahead(db(query), 7, 3)) {
+      ++expected;
+      assert(row.id == expected);
+      assert(row.intN == expected);
+      assert(row.textNnD == std::to_string(expected));
+    }
+    assert(expected == 100);
+  }
+
+  // Stopping early
+  {
+    auto result = sqlpp::read_ahead(db(query), 10);
+    assert(not result.empty());
+    assert(result.front().id == 1);
+    result.pop_front();
+    assert(result.front().id == 2);
+  }
+
+  // Empty result
+  {
+    auto result = sqlpp::read_ahead(
+        db(select(tab.id).from(tab).where(tab.id > 1000)));
+    assert(result.empty());
+    assert(result.begin() == result.end());
+  }
+
+  // The connection can be used again afterwards.
+  assert(db(select(count(tab.id).as(sqlpp::alias::a)).from(tab))
+             .front()
+             .a == 100);
+
+  return 0;
+}
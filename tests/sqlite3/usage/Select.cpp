@@ -169,5 +169,38 @@ int Select(int, char*[]) {
   tx.commit();
   std::cerr << "--------------------------------------" << std::endl;
 
+  // IN with an array parameter, followed by a regular parameter
+  {
+    auto prepared = db.prepare(
+        select(tab.id)
+            .from(tab)
+            .where(tab.id.in(sqlpp::array_parameter<8>(tab.id)) and
+                   tab.textNnD != parameter(tab.textNnD)));
+    prepared.parameters.textNnD = "";
+    prepared.parameters.id = {1, 3};
+    size_t count = 0;
+    for (const auto& row : db(prepared)) {
+      assert(row.id == 1 or row.id == 3);
+      ++count;
+    }
+    assert(count == 1);  // Only row 3 has a non-empty text
+
+    prepared.parameters.id = {1, 2, 3};
+    prepared.parameters.textNnD = "no match";
+    count = 0;
+    for (const auto& row : db(prepared)) {
+      assert(row.id > 0);
+      ++count;
+    }
+    assert(count == 3);
+
+    prepared.parameters.id = std::vector<int64_t>(9, 1);
+    try {
+      db(prepared);
+      assert(false);
+    } catch (const sqlpp::exception&) {
+    }
+  }
+
   return 0;
 }
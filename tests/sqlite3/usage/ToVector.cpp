@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025, Roland Bock
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <memory_resource>
+
+#include <sqlpp23/tests/sqlite3/all.h>
+
+namespace sql = sqlpp::sqlite3;
+
+int ToVector(int, char*[]) {
+  const auto tab = test::TabFoo{};
+
+  auto db = sql::make_test_connection();
+  test::createTabFoo(db);
+
+  db(insert_into(tab).set(tab.textNnD = "one", tab.intN = 1,
+                          tab.blobN = std::vector<uint8_t>{0x01, 0x02}));
+  db(insert_into(tab).set(tab.textNnD = "two", tab.intN = std::nullopt));
+  db(insert_into(tab).set(tab.textNnD = "three", tab.intN = 3));
+
+  const auto query =
+      select(tab.id, tab.textNnD, tab.intN, tab.blobN).from(tab).order_by(
+          tab.id.asc());
+
+  std::pmr::monotonic_buffer_resource arena;
+
+  // All rows. The views stay valid after the result is gone.
+  {
+    const auto rows = sqlpp::to_vector(db(query), arena);
+    assert(rows.size() == 3);
+    assert(rows[0].id == 1);
+    assert(rows[0].textNnD == "one");
+    assert(rows[0].intN == 1);
+    assert(rows[0].blobN.has_value());
+    assert(rows[0].blobN->size() == 2);
+    assert((*rows[0].blobN)[1] == 0x02);
+    assert(rows[1].textNnD == "two");
+    assert(not rows[1].intN.has_value());
+    assert(not rows[1].blobN.has_value());
+    assert(rows[2].textNnD == "three");
+    assert(rows[2].intN == 3);
+    for (const auto& row : rows) {
+      assert(row);
+    }
+  }
+
+  // Bounded number of rows, the result can continue from there.
+  {
+    auto result = db(query);
+    const auto first = sqlpp::to_vector(result, arena, 2);
+    assert(first.size() == 2);
+    const auto rest = sqlpp::to_vector(result, arena, 2);
+    assert(rest.size() == 1);
+    assert(first[0].textNnD == "one");
+    assert(first[1].textNnD == "two");
+    assert(rest[0].textNnD == "three");
+    assert(result.empty());
+  }
+
+  // Prepared statements
+  {
+    auto prepared = db.prepare(select(tab.textNnD)
+                                   .from(tab)
+                                   .where(tab.id > parameter(tab.id))
+                                   .order_by(tab.id.asc()));
+    prepared.parameters.id = 1;
+    const auto rows = sqlpp::to_vector(db(prepared), arena);
+    assert(rows.size() == 2);
+    assert(rows[0].textNnD == "two");
+    assert(rows[1].textNnD == "three");
+  }
+
+  return 0;
+}
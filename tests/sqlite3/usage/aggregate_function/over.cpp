@@ -68,6 +68,47 @@ int main(int, char*[]) {
       assert(row.min_.value() == 7);
       assert(row.sum_.value() == 23);
     }
+
+    // select window functions and framed aggregates
+    const auto expected =
+        std::vector<std::tuple<int64_t, int64_t, int64_t,
+                               std::optional<int64_t>, int64_t>>{
+            {1, 1, 1, std::nullopt, 7}, {2, 1, 1, 7, 14}, {3, 3, 2, 7, 23}};
+    auto i = size_t{0};
+    for (const auto& row :
+         db(select(sqlpp::row_number()
+                       .over()
+                       .order_by(tab.id.asc())
+                       .as(sqlpp::alias::row_number_),
+                   sqlpp::rank()
+                       .over()
+                       .order_by(tab.intN.asc())
+                       .as(sqlpp::alias::rank_),
+                   sqlpp::dense_rank()
+                       .over()
+                       .order_by(tab.intN.asc())
+                       .as(sqlpp::alias::dense_rank_),
+                   lag(tab.intN).over().order_by(tab.id.asc()).as(
+                       sqlpp::alias::lag_),
+                   sum(tab.intN)
+                       .over()
+                       .order_by(tab.id.asc())
+                       .rows_between(sqlpp::unbounded_preceding,
+                                     sqlpp::current_row)
+                       .as(sqlpp::alias::sum_))
+                .from(tab)
+                .order_by(tab.id.asc()))) {
+      assert(i < expected.size());
+      const auto& [number, ranking, dense_ranking, previous, running_sum] =
+          expected[i];
+      assert(row.row_number_ == number);
+      assert(row.rank_ == ranking);
+      assert(row.dense_rank_ == dense_ranking);
+      assert(row.lag_ == previous);
+      assert(row.sum_.value() == running_sum);
+      ++i;
+    }
+    assert(i == expected.size());
   } catch (const std::exception& e) {
     std::cerr << "Exception: " << e.what() << std::endl;
     return 1;
@@ -24,6 +24,10 @@
  * POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+#include <stop_token>
+#include <thread>
+
 #include <sqlpp23/tests/sqlite3/all.h>
 
 namespace sql = sqlpp::sqlite3;
@@ -58,6 +62,29 @@ int main() {
         throw std::runtime_error("unexpected meta information in exception");
       }
     }
+
+    // Statements running into the statement timeout are interrupted
+    const auto runaway =
+        "WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c) "
+        "SELECT count(*) FROM c";
+    db.set_statement_timeout(std::chrono::milliseconds{100});
+    assert_throw(db(runaway), sql::timeout_exception);
+    db.set_statement_timeout(std::chrono::milliseconds{0});
+
+    // Statements can be interrupted from another thread
+    {
+      auto canceler = std::jthread{[handle = db.get_cancel_handle()](
+                                       std::stop_token stop) {
+        while (not stop.stop_requested()) {
+          handle.cancel();
+          std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+      }};
+      assert_throw(db(runaway), sql::timeout_exception);
+    }
+
+    // The connection is still usable
+    db(insert_into(foo).set(foo.id = 8));
   } catch (const std::exception& e) {
     std::println("unexpected exception: {}", e.what());
     return 1;